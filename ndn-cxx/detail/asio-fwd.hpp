@@ -24,6 +24,7 @@
 
 namespace boost::asio {
 class io_context;
+class thread_pool;
 } // namespace boost::asio
 
 #endif // NDN_CXX_DETAIL_ASIO_FWD_HPP
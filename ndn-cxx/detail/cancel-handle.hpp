@@ -63,8 +63,8 @@ CancelHandle::CancelHandle() noexcept = default;
 template<typename HandleT>
 class ScopedCancelHandle
 {
-  static_assert(std::is_convertible_v<HandleT*, CancelHandle*>,
-                "HandleT must publicly derive from CancelHandle");
+  static_assert(std::is_invocable_v<decltype(&HandleT::cancel), const HandleT&>,
+                "HandleT must have a cancel() const member function");
 
 public:
   ScopedCancelHandle() noexcept;
@@ -0,0 +1,72 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/mapped-file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ndn::detail {
+
+MappedFile::MappedFile(const std::string& path)
+{
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    NDN_THROW_ERRNO(Error("Cannot open " + path));
+  }
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    NDN_THROW_ERRNO(Error("Cannot stat " + path));
+  }
+  if (!S_ISREG(st.st_mode)) {
+    ::close(fd);
+    NDN_THROW(Error(path + " is not a regular file"));
+  }
+
+  m_size = static_cast<size_t>(st.st_size);
+  if (m_size > 0) {
+    // an empty file cannot be mapped
+    void* addr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+      ::close(fd);
+      NDN_THROW_ERRNO(Error("Cannot map " + path));
+    }
+    m_addr = static_cast<const uint8_t*>(addr);
+    // the file is usually read from start to end; this is only a hint
+    ::madvise(addr, m_size, MADV_SEQUENTIAL);
+  }
+
+  // the mapping remains valid after the file descriptor is closed
+  ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+  if (m_addr != nullptr) {
+    ::munmap(const_cast<uint8_t*>(m_addr), m_size);
+  }
+}
+
+} // namespace ndn::detail
@@ -0,0 +1,66 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_DETAIL_MAPPED_FILE_HPP
+#define NDN_CXX_DETAIL_MAPPED_FILE_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/util/span.hpp"
+
+namespace ndn::detail {
+
+/**
+ * \brief Read-only memory mapping of an entire file.
+ *
+ * The file is mapped privately, so its content is paged in on demand from the page cache
+ * rather than copied into heap memory.
+ */
+class MappedFile : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * \throw Error the file cannot be opened or mapped
+   */
+  explicit
+  MappedFile(const std::string& path);
+
+  ~MappedFile();
+
+  span<const uint8_t>
+  getContent() const noexcept
+  {
+    return {m_addr, m_size};
+  }
+
+private:
+  const uint8_t* m_addr = nullptr;
+  size_t m_size = 0;
+};
+
+} // namespace ndn::detail
+
+#endif // NDN_CXX_DETAIL_MAPPED_FILE_HPP
@@ -0,0 +1,233 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_DETAIL_SEGMENT_RING_HPP
+#define NDN_CXX_DETAIL_SEGMENT_RING_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace ndn::detail {
+
+/**
+ * \brief Circular array of per-segment entries, indexed by segment number.
+ *
+ * SegmentRing stores entries for a sliding range of segment numbers `[getBegin(), getEnd())`.
+ * The entry of segment `n` lives in slot `n % capacity`, so that lookup, insertion, and removal
+ * take constant time and do not allocate memory, as long as the range fits in the capacity.
+ * Otherwise, the capacity is doubled until the range fits.
+ *
+ * The range is extended by insertions, and shrunk only by trimFront() and popFront(). An insertion
+ * into an empty ring restarts the range at the inserted segment, so that the capacity depends only
+ * on the distance between the live segment numbers, not on their magnitude.
+ */
+template<typename T>
+class SegmentRing
+{
+public:
+  explicit
+  SegmentRing(size_t initialCapacity = 64)
+  {
+    size_t capacity = 1;
+    while (capacity < initialCapacity) {
+      capacity <<= 1;
+    }
+    m_slots.resize(capacity);
+  }
+
+  /**
+   * \brief Return the lowest segment number in the range.
+   */
+  uint64_t
+  getBegin() const noexcept
+  {
+    return m_begin;
+  }
+
+  /**
+   * \brief Return one past the highest segment number in the range.
+   */
+  uint64_t
+  getEnd() const noexcept
+  {
+    return m_end;
+  }
+
+  /**
+   * \brief Return the number of entries.
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+  bool
+  empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  size_t
+  capacity() const noexcept
+  {
+    return m_slots.size();
+  }
+
+  /**
+   * \brief Return the entry of segment \p seg, or nullptr if there is none.
+   */
+  T*
+  find(uint64_t seg) noexcept
+  {
+    if (seg < m_begin || seg >= m_end) {
+      return nullptr;
+    }
+    auto& slot = m_slots[index(seg)];
+    return slot ? &*slot : nullptr;
+  }
+
+  const T*
+  find(uint64_t seg) const noexcept
+  {
+    return const_cast<SegmentRing*>(this)->find(seg);
+  }
+
+  /**
+   * \brief Insert an entry for segment \p seg, constructed from \p args, unless there is one.
+   * \return a pointer to the entry of segment \p seg, and whether it has been inserted
+   * \pre seg < std::numeric_limits<uint64_t>::max()
+   */
+  template<typename... Args>
+  std::pair<T*, bool>
+  tryEmplace(uint64_t seg, Args&&... args)
+  {
+    if (auto* existing = find(seg); existing != nullptr) {
+      return {existing, false};
+    }
+
+    if (m_size == 0) {
+      m_begin = m_end = seg;
+    }
+    uint64_t newBegin = std::min(m_begin, seg);
+    uint64_t newEnd = std::max(m_end, seg + 1);
+    if (newEnd - newBegin > m_slots.size()) {
+      grow(newEnd - newBegin);
+    }
+    m_begin = newBegin;
+    m_end = newEnd;
+
+    auto& slot = m_slots[index(seg)];
+    slot.emplace(std::forward<Args>(args)...);
+    ++m_size;
+    return {&*slot, true};
+  }
+
+  /**
+   * \brief Remove the entry of segment \p seg, if any.
+   */
+  void
+  erase(uint64_t seg) noexcept
+  {
+    if (seg < m_begin || seg >= m_end) {
+      return;
+    }
+    auto& slot = m_slots[index(seg)];
+    if (slot) {
+      slot.reset();
+      --m_size;
+    }
+  }
+
+  /**
+   * \brief Remove the entry of segment getBegin(), if any, and exclude it from the range.
+   * \pre getBegin() < getEnd()
+   */
+  void
+  popFront() noexcept
+  {
+    erase(m_begin);
+    ++m_begin;
+  }
+
+  /**
+   * \brief Exclude the segments without an entry at the start of the range.
+   */
+  void
+  trimFront() noexcept
+  {
+    while (m_begin < m_end && !m_slots[index(m_begin)]) {
+      ++m_begin;
+    }
+  }
+
+  /**
+   * \brief Remove all entries, and make the range empty.
+   */
+  void
+  clear() noexcept
+  {
+    for (auto seg = m_begin; seg < m_end; ++seg) {
+      m_slots[index(seg)].reset();
+    }
+    m_begin = m_end;
+    m_size = 0;
+  }
+
+private:
+  size_t
+  index(uint64_t seg) const noexcept
+  {
+    return static_cast<size_t>(seg & (m_slots.size() - 1));
+  }
+
+  void
+  grow(uint64_t minCapacity)
+  {
+    size_t capacity = m_slots.size();
+    while (capacity < minCapacity) {
+      capacity <<= 1;
+    }
+
+    std::vector<std::optional<T>> slots(capacity);
+    for (auto seg = m_begin; seg < m_end; ++seg) {
+      auto& slot = m_slots[index(seg)];
+      if (slot) {
+        slots[seg & (capacity - 1)] = std::move(slot);
+      }
+    }
+    m_slots = std::move(slots);
+  }
+
+private:
+  std::vector<std::optional<T>> m_slots;
+  uint64_t m_begin = 0;
+  uint64_t m_end = 0;
+  size_t m_size = 0;
+};
+
+} // namespace ndn::detail
+
+#endif // NDN_CXX_DETAIL_SEGMENT_RING_HPP
@@ -0,0 +1,279 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_DETAIL_UNIQUE_FUNCTION_HPP
+#define NDN_CXX_DETAIL_UNIQUE_FUNCTION_HPP
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ndn::detail {
+
+template<typename Signature, size_t InlineSize = 48>
+class UniqueFunction;
+
+template<typename T>
+inline constexpr bool isStdFunction = false;
+
+template<typename Signature>
+inline constexpr bool isStdFunction<std::function<Signature>> = true;
+
+template<typename T>
+inline constexpr bool isUniqueFunction = false;
+
+template<typename Signature, size_t InlineSize>
+inline constexpr bool isUniqueFunction<UniqueFunction<Signature, InlineSize>> = true;
+
+/**
+ * \brief Move-only polymorphic function wrapper with a large small-object buffer.
+ *
+ * UniqueFunction can be used in place of `std::function` for callbacks that are stored once
+ * and never copied. Any callable whose size does not exceed \p InlineSize octets and whose move
+ * constructor is `noexcept` is stored inline, without any heap allocation. Larger callables,
+ * as well as callables that may throw when moved, are stored on the heap.
+ *
+ * Like `std::function`, an empty UniqueFunction compares equal to `nullptr`, and constructing
+ * a UniqueFunction from a null function pointer or an empty `std::function` yields an empty
+ * UniqueFunction.
+ */
+template<typename R, typename... Args, size_t InlineSize>
+class UniqueFunction<R(Args...), InlineSize>
+{
+private:
+  struct Ops
+  {
+    R (*invoke)(void* storage, Args&&... args);
+    void (*relocate)(void* dst, void* src) noexcept;
+    void (*destroy)(void* storage) noexcept;
+  };
+
+  template<typename Fn>
+  static constexpr bool isStoredInline = sizeof(Fn) <= InlineSize &&
+                                         alignof(Fn) <= alignof(std::max_align_t) &&
+                                         std::is_nothrow_move_constructible_v<Fn>;
+
+  template<typename Fn>
+  struct InlineOps
+  {
+    static R
+    invoke(void* storage, Args&&... args)
+    {
+      return std::invoke(*static_cast<Fn*>(storage), std::forward<Args>(args)...);
+    }
+
+    static void
+    relocate(void* dst, void* src) noexcept
+    {
+      auto* fn = static_cast<Fn*>(src);
+      ::new (dst) Fn(std::move(*fn));
+      fn->~Fn();
+    }
+
+    static void
+    destroy(void* storage) noexcept
+    {
+      static_cast<Fn*>(storage)->~Fn();
+    }
+
+    static constexpr Ops table{&invoke, &relocate, &destroy};
+  };
+
+  template<typename Fn>
+  struct HeapOps
+  {
+    static R
+    invoke(void* storage, Args&&... args)
+    {
+      return std::invoke(**static_cast<Fn**>(storage), std::forward<Args>(args)...);
+    }
+
+    static void
+    relocate(void* dst, void* src) noexcept
+    {
+      ::new (dst) Fn*(*static_cast<Fn**>(src));
+    }
+
+    static void
+    destroy(void* storage) noexcept
+    {
+      delete *static_cast<Fn**>(storage);
+    }
+
+    static constexpr Ops table{&invoke, &relocate, &destroy};
+  };
+
+  template<typename F, typename Fn = std::decay_t<F>>
+  using EnableIfCallable = std::enable_if_t<!std::is_same_v<Fn, UniqueFunction> &&
+                                            std::is_invocable_r_v<R, Fn&, Args...>>;
+
+public:
+  UniqueFunction() noexcept = default;
+
+  UniqueFunction(std::nullptr_t) noexcept
+  {
+  }
+
+  /**
+   * \brief Construct from a callable object.
+   */
+  template<typename F, typename = EnableIfCallable<F>>
+  UniqueFunction(F&& f)
+  {
+    using Fn = std::decay_t<F>;
+
+    if constexpr (std::is_pointer_v<Fn> || std::is_member_pointer_v<Fn> ||
+                  isStdFunction<Fn> || isUniqueFunction<Fn>) {
+      if (f == nullptr) {
+        return;
+      }
+    }
+
+    if constexpr (isStoredInline<Fn>) {
+      ::new (&m_storage) Fn(std::forward<F>(f));
+      m_ops = &InlineOps<Fn>::table;
+    }
+    else {
+      ::new (&m_storage) Fn*(new Fn(std::forward<F>(f)));
+      m_ops = &HeapOps<Fn>::table;
+    }
+  }
+
+  UniqueFunction(UniqueFunction&& other) noexcept
+  {
+    moveFrom(other);
+  }
+
+  UniqueFunction&
+  operator=(UniqueFunction&& other) noexcept
+  {
+    if (this != &other) {
+      reset();
+      moveFrom(other);
+    }
+    return *this;
+  }
+
+  UniqueFunction&
+  operator=(std::nullptr_t) noexcept
+  {
+    reset();
+    return *this;
+  }
+
+  template<typename F, typename = EnableIfCallable<F>>
+  UniqueFunction&
+  operator=(F&& f)
+  {
+    UniqueFunction(std::forward<F>(f)).swap(*this);
+    return *this;
+  }
+
+  UniqueFunction(const UniqueFunction&) = delete;
+
+  UniqueFunction&
+  operator=(const UniqueFunction&) = delete;
+
+  ~UniqueFunction()
+  {
+    reset();
+  }
+
+  explicit
+  operator bool() const noexcept
+  {
+    return m_ops != nullptr;
+  }
+
+  /**
+   * \brief Invoke the stored callable.
+   * \throw std::bad_function_call the UniqueFunction is empty
+   */
+  R
+  operator()(Args... args) const
+  {
+    if (m_ops == nullptr) {
+      throw std::bad_function_call();
+    }
+    return m_ops->invoke(&m_storage, std::forward<Args>(args)...);
+  }
+
+  void
+  swap(UniqueFunction& other) noexcept
+  {
+    UniqueFunction tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+private:
+  void
+  moveFrom(UniqueFunction& other) noexcept
+  {
+    if (other.m_ops != nullptr) {
+      other.m_ops->relocate(&m_storage, &other.m_storage);
+      m_ops = std::exchange(other.m_ops, nullptr);
+    }
+  }
+
+  void
+  reset() noexcept
+  {
+    if (m_ops != nullptr) {
+      std::exchange(m_ops, nullptr)->destroy(&m_storage);
+    }
+  }
+
+private: // non-member operators
+  friend bool
+  operator==(const UniqueFunction& f, std::nullptr_t) noexcept
+  {
+    return !f;
+  }
+
+  friend bool
+  operator==(std::nullptr_t, const UniqueFunction& f) noexcept
+  {
+    return !f;
+  }
+
+  friend bool
+  operator!=(const UniqueFunction& f, std::nullptr_t) noexcept
+  {
+    return static_cast<bool>(f);
+  }
+
+  friend bool
+  operator!=(std::nullptr_t, const UniqueFunction& f) noexcept
+  {
+    return static_cast<bool>(f);
+  }
+
+private:
+  alignas(std::max_align_t) mutable unsigned char m_storage[InlineSize];
+  const Ops* m_ops = nullptr;
+};
+
+} // namespace ndn::detail
+
+#endif // NDN_CXX_DETAIL_UNIQUE_FUNCTION_HPP
@@ -27,6 +27,7 @@
 #include "ndn-cxx/transport/tcp-transport.hpp"
 #include "ndn-cxx/transport/unix-transport.hpp"
 #include "ndn-cxx/util/config-file.hpp"
+#include "ndn-cxx/util/packet-tracer.hpp"
 #include "ndn-cxx/util/scope.hpp"
 #include "ndn-cxx/util/time.hpp"
 
@@ -152,14 +153,28 @@ Face::expressInterest(const Interest& interest,
                       const DataCallback& afterSatisfied,
                       const NackCallback& afterNacked,
                       const TimeoutCallback& afterTimeout)
+{
+  return expressInterestImpl(interest, afterSatisfied, afterNacked, afterTimeout);
+}
+
+PendingInterestHandle
+Face::expressInterestImpl(const Interest& interest,
+                          detail::UniqueDataCallback afterSatisfied,
+                          detail::UniqueNackCallback afterNacked,
+                          detail::UniqueTimeoutCallback afterTimeout)
 {
   auto id = m_impl->m_pendingInterestTable.allocateId();
   auto interest2 = make_shared<Interest>(interest);
   interest2->getNonce();
 
-  boost::asio::post(m_ioCtx, [=, w = m_impl->weak_from_this()] {
+  boost::asio::post(m_ioCtx, [id, interest2 = std::move(interest2),
+                              afterSatisfied = std::move(afterSatisfied),
+                              afterNacked = std::move(afterNacked),
+                              afterTimeout = std::move(afterTimeout),
+                              w = m_impl->weak_from_this()] () mutable {
     if (auto impl = w.lock(); impl != nullptr) {
-      impl->expressInterest(id, interest2, afterSatisfied, afterNacked, afterTimeout);
+      impl->expressInterest(id, std::move(interest2), std::move(afterSatisfied),
+                            std::move(afterNacked), std::move(afterTimeout));
     }
   });
 
@@ -182,6 +197,12 @@ Face::getNPendingInterests() const
   return m_impl->m_pendingInterestTable.size();
 }
 
+const FaceCounters&
+Face::getCounters() const noexcept
+{
+  return m_impl->m_counters;
+}
+
 void
 Face::put(const Data& data)
 {
@@ -310,6 +331,8 @@ extractLpLocalFields(NetPkt& netPacket, const lp::Packet& lpPacket)
 void
 Face::onReceiveElement(const Block& blockFromDaemon)
 {
+  m_impl->m_counters.nInBytes += blockFromDaemon.size();
+
   lp::Packet lpPacket(blockFromDaemon); // bare Interest/Data is a valid lp::Packet,
                                         // no need to distinguish
 
@@ -323,11 +346,17 @@ Face::onReceiveElement(const Block& blockFromDaemon)
         nack->setHeader(lpPacket.get<lp::NackField>());
         extractLpLocalFields(*nack, lpPacket);
         NDN_LOG_DEBUG(">N " << nack->getInterest() << '~' << nack->getHeader().getReason());
+        ++m_impl->m_counters.nInNacks;
+        util::PacketTracer::record(util::PacketTraceEvent::IN_NACK, nack->getInterest().getName(),
+                                   blockFromDaemon.size());
         m_impl->nackPendingInterests(*nack);
       }
       else {
         extractLpLocalFields(*interest, lpPacket);
         NDN_LOG_DEBUG(">I " << *interest);
+        ++m_impl->m_counters.nInInterests;
+        util::PacketTracer::record(util::PacketTraceEvent::IN_INTEREST, interest->getName(),
+                                   blockFromDaemon.size());
         m_impl->processIncomingInterest(std::move(interest));
       }
       break;
@@ -336,6 +365,9 @@ Face::onReceiveElement(const Block& blockFromDaemon)
       auto data = make_shared<Data>(netPacket);
       extractLpLocalFields(*data, lpPacket);
       NDN_LOG_DEBUG(">D " << data->getName());
+      ++m_impl->m_counters.nInData;
+      util::PacketTracer::record(util::PacketTraceEvent::IN_DATA, data->getName(),
+                                 blockFromDaemon.size());
       m_impl->satisfyPendingInterests(*data);
       break;
     }
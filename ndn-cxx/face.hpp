@@ -27,10 +27,12 @@
 #include "ndn-cxx/interest-filter.hpp"
 #include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/detail/cancel-handle.hpp"
+#include "ndn-cxx/detail/unique-function.hpp"
 #include "ndn-cxx/encoding/nfd-constants.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/security/key-chain.hpp"
 #include "ndn-cxx/security/signing-info.hpp"
+#include "ndn-cxx/util/counters.hpp"
 
 namespace ndn {
 
@@ -59,6 +61,13 @@ using NackCallback = std::function<void(const Interest&, const lp::Nack&)>;
  */
 using TimeoutCallback = std::function<void(const Interest&)>;
 
+namespace detail {
+// move-only counterparts of the above, used to store the callbacks of pending Interests
+using UniqueDataCallback = UniqueFunction<void(const Interest&, const Data&)>;
+using UniqueNackCallback = UniqueFunction<void(const Interest&, const lp::Nack&)>;
+using UniqueTimeoutCallback = UniqueFunction<void(const Interest&)>;
+} // namespace detail
+
 /**
  * @brief Callback invoked when an incoming Interest matches the specified InterestFilter
  */
@@ -84,6 +93,31 @@ using UnregisterPrefixSuccessCallback = std::function<void()>;
  */
 using UnregisterPrefixFailureCallback = std::function<void(const std::string&)>;
 
+/**
+ * @brief Packet, byte, and latency counters of a Face.
+ *
+ * The counters are updated on the thread running the Face's io_context
+ * and can be read from any thread.
+ */
+struct FaceCounters : noncopyable
+{
+  util::Counter nInInterests;  ///< Interests received from the forwarder
+  util::Counter nInData;       ///< Data received from the forwarder
+  util::Counter nInNacks;      ///< Nacks received from the forwarder
+  util::Counter nOutInterests; ///< Interests sent to the forwarder
+  util::Counter nOutData;      ///< Data sent to the forwarder
+  util::Counter nOutNacks;     ///< Nacks sent to the forwarder
+  util::Counter nInBytes;      ///< octets received from the forwarder, including NDNLPv2 headers
+  util::Counter nOutBytes;     ///< octets sent to the forwarder, including NDNLPv2 headers
+
+  util::Counter nSatisfiedInterests; ///< expressed Interests that were satisfied by Data
+  util::Counter nNackedInterests;    ///< expressed Interests that were rejected by a Nack
+  util::Counter nTimedOutInterests;  ///< expressed Interests that timed out
+
+  /// Round-trip time of satisfied Interests, measured from expressInterest() to Data arrival.
+  util::LatencyHistogram rtt;
+};
+
 /**
  * @brief Provide a communication channel with local or remote NDN forwarder
  */
@@ -235,6 +269,23 @@ public: // consumer
                   const NackCallback& afterNacked,
                   const TimeoutCallback& afterTimeout);
 
+  /**
+   * @brief Express an Interest.
+   *
+   * Same as the overload taking DataCallback, NackCallback, and TimeoutCallback, except that
+   * the callbacks are not converted to `std::function`. They may be move-only, and callables
+   * with up to 48 octets of captures are stored without heap allocation.
+   */
+  template<typename OnData, typename OnNack, typename OnTimeout,
+           typename = std::enable_if_t<std::is_constructible_v<detail::UniqueDataCallback, OnData> &&
+                                       std::is_constructible_v<detail::UniqueNackCallback, OnNack> &&
+                                       std::is_constructible_v<detail::UniqueTimeoutCallback, OnTimeout>>>
+  PendingInterestHandle
+  expressInterest(const Interest& interest,
+                  OnData&& afterSatisfied,
+                  OnNack&& afterNacked,
+                  OnTimeout&& afterTimeout);
+
   /**
    * @brief Cancel all previously expressed Interests.
    */
@@ -243,10 +294,18 @@ public: // consumer
 
   /**
    * @brief Get number of pending Interests.
+   * @note This method can be called from any thread.
    */
   size_t
   getNPendingInterests() const;
 
+  /**
+   * @brief Returns the packet and latency counters of this face.
+   * @note The returned counters can be read from any thread.
+   */
+  const FaceCounters&
+  getCounters() const noexcept;
+
 public: // producer
   /**
    * @brief Set InterestFilter to dispatch incoming matching interest to onInterest
@@ -445,6 +504,12 @@ private:
   void
   construct(shared_ptr<Transport> transport, KeyChain& keyChain);
 
+  PendingInterestHandle
+  expressInterestImpl(const Interest& interest,
+                      detail::UniqueDataCallback afterSatisfied,
+                      detail::UniqueNackCallback afterNacked,
+                      detail::UniqueTimeoutCallback afterTimeout);
+
   void
   onReceiveElement(const Block& blockFromDaemon);
 
@@ -580,6 +645,19 @@ private:
  */
 using ScopedInterestFilterHandle = detail::ScopedCancelHandle<InterestFilterHandle>;
 
+template<typename OnData, typename OnNack, typename OnTimeout, typename>
+PendingInterestHandle
+Face::expressInterest(const Interest& interest,
+                      OnData&& afterSatisfied,
+                      OnNack&& afterNacked,
+                      OnTimeout&& afterTimeout)
+{
+  return expressInterestImpl(interest,
+                             detail::UniqueDataCallback(std::forward<OnData>(afterSatisfied)),
+                             detail::UniqueNackCallback(std::forward<OnNack>(afterNacked)),
+                             detail::UniqueTimeoutCallback(std::forward<OnTimeout>(afterTimeout)));
+}
+
 } // namespace ndn
 
 #endif // NDN_CXX_FACE_HPP
@@ -34,6 +34,7 @@
 #include "ndn-cxx/mgmt/nfd/controller.hpp"
 #include "ndn-cxx/transport/transport.hpp"
 #include "ndn-cxx/util/logger.hpp"
+#include "ndn-cxx/util/packet-tracer.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
 
 #include <boost/asio/io_context.hpp>
@@ -90,24 +91,26 @@ public:
 public: // consumer
   void
   expressInterest(detail::RecordId id, shared_ptr<const Interest> interest,
-                  const DataCallback& afterSatisfied,
-                  const NackCallback& afterNacked,
-                  const TimeoutCallback& afterTimeout)
+                  detail::UniqueDataCallback afterSatisfied,
+                  detail::UniqueNackCallback afterNacked,
+                  detail::UniqueTimeoutCallback afterTimeout)
   {
     NDN_LOG_DEBUG("<I " << *interest);
     this->ensureConnected(true);
 
     const Interest& interest2 = *interest;
-    auto& entry = m_pendingInterestTable.put(id, std::move(interest), afterSatisfied,
-                                             afterNacked, afterTimeout, m_scheduler);
+    auto& entry = m_pendingInterestTable.put(id, std::move(interest), std::move(afterSatisfied),
+                                             std::move(afterNacked), std::move(afterTimeout),
+                                             m_scheduler, m_counters);
 
     lp::Packet lpPacket;
     addFieldFromTag<lp::NextHopFaceIdField, lp::NextHopFaceIdTag>(lpPacket, interest2);
     addFieldFromTag<lp::CongestionMarkField, lp::CongestionMarkTag>(lpPacket, interest2);
 
     entry.recordForwarding();
-    m_face.m_transport->send(finishEncoding(std::move(lpPacket), interest2.wireEncode(),
-                                            'I', interest2.getName()));
+    transmit(finishEncoding(std::move(lpPacket), interest2.wireEncode(), 'I', interest2.getName()),
+             util::PacketTraceEvent::OUT_INTEREST, interest2.getName(), id);
+    ++m_counters.nOutInterests;
     dispatchInterest(entry, interest2);
   }
 
@@ -134,6 +137,7 @@ public: // consumer
   satisfyPendingInterests(const Data& data)
   {
     bool hasAppMatch = false, hasForwarderMatch = false;
+    std::optional<time::steady_clock::time_point> now;
     m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
       if (!entry.getInterest()->matchesData(data)) {
         return false;
@@ -142,6 +146,13 @@ public: // consumer
 
       if (entry.getOrigin() == PendingInterestOrigin::APP) {
         hasAppMatch = true;
+        if (!now) {
+          now = time::steady_clock::now();
+        }
+        ++m_counters.nSatisfiedInterests;
+        m_counters.rtt.add(*now - entry.getExpressTime());
+        util::PacketTracer::record(util::PacketTraceEvent::SATISFIED, data.getName(),
+                                   data.wireEncode().size(), entry.getId());
         entry.invokeDataCallback(data);
       }
       else {
@@ -174,6 +185,9 @@ public: // consumer
       }
 
       if (entry.getOrigin() == PendingInterestOrigin::APP) {
+        ++m_counters.nNackedInterests;
+        util::PacketTracer::record(util::PacketTraceEvent::NACKED, entry.getInterest()->getName(),
+                                   0, entry.getId());
         entry.invokeNackCallback(*outNack1);
       }
       else {
@@ -229,8 +243,9 @@ public: // producer
     addFieldFromTag<lp::CachePolicyField, lp::CachePolicyTag>(lpPacket, data);
     addFieldFromTag<lp::CongestionMarkField, lp::CongestionMarkTag>(lpPacket, data);
 
-    m_face.m_transport->send(finishEncoding(std::move(lpPacket), data.wireEncode(),
-                                            'D', data.getName()));
+    transmit(finishEncoding(std::move(lpPacket), data.wireEncode(), 'D', data.getName()),
+             util::PacketTraceEvent::OUT_DATA, data.getName());
+    ++m_counters.nOutData;
   }
 
   void
@@ -249,8 +264,9 @@ public: // producer
     addFieldFromTag<lp::CongestionMarkField, lp::CongestionMarkTag>(lpPacket, *outNack);
 
     const Interest& interest = outNack->getInterest();
-    m_face.m_transport->send(finishEncoding(std::move(lpPacket), interest.wireEncode(),
-                                            'N', interest.getName()));
+    transmit(finishEncoding(std::move(lpPacket), interest.wireEncode(), 'N', interest.getName()),
+             util::PacketTraceEvent::OUT_NACK, interest.getName());
+    ++m_counters.nOutNacks;
   }
 
 public: // prefix registration
@@ -350,6 +366,15 @@ private:
     return wire;
   }
 
+  void
+  transmit(const Block& wire, util::PacketTraceEvent event, const Name& name,
+           detail::RecordId pitId = 0)
+  {
+    m_face.m_transport->send(wire);
+    m_counters.nOutBytes += wire.size();
+    util::PacketTracer::record(event, name, wire.size(), pitId);
+  }
+
   void
   dispatchInterest(PendingInterest& entry, const Interest& interest)
   {
@@ -415,6 +440,7 @@ private:
   Scheduler m_scheduler;
   scheduler::ScopedEventId m_processEventsTimeoutEvent;
   nfd::Controller m_nfdController;
+  FaceCounters m_counters;
 
   detail::RecordContainer<PendingInterest> m_pendingInterestTable;
   detail::RecordContainer<InterestFilterRecord> m_interestFilterTable;
@@ -27,6 +27,7 @@
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/impl/record-container.hpp"
 #include "ndn-cxx/lp/nack.hpp"
+#include "ndn-cxx/util/packet-tracer.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
 
 namespace ndn {
@@ -63,15 +64,19 @@ public:
    *
    * The timeout is set based on the current time and InterestLifetime.
    * This class will invoke the timeout callback unless the record is deleted before timeout.
+   * If the Interest times out, @p counters.nTimedOutInterests is incremented.
    */
-  PendingInterest(shared_ptr<const Interest> interest, const DataCallback& dataCallback,
-                  const NackCallback& nackCallback, const TimeoutCallback& timeoutCallback,
-                  Scheduler& scheduler)
+  PendingInterest(shared_ptr<const Interest> interest, detail::UniqueDataCallback dataCallback,
+                  detail::UniqueNackCallback nackCallback,
+                  detail::UniqueTimeoutCallback timeoutCallback,
+                  Scheduler& scheduler, FaceCounters& counters)
     : m_interest(std::move(interest))
     , m_origin(PendingInterestOrigin::APP)
-    , m_dataCallback(dataCallback)
-    , m_nackCallback(nackCallback)
-    , m_timeoutCallback(timeoutCallback)
+    , m_expressTime(time::steady_clock::now())
+    , m_dataCallback(std::move(dataCallback))
+    , m_nackCallback(std::move(nackCallback))
+    , m_timeoutCallback(std::move(timeoutCallback))
+    , m_counters(&counters)
   {
     scheduleTimeoutEvent(scheduler);
   }
@@ -98,6 +103,16 @@ public:
     return m_origin;
   }
 
+  /**
+   * @brief Returns the time when the Interest was expressed by the app.
+   * @pre getOrigin() == PendingInterestOrigin::APP
+   */
+  time::steady_clock::time_point
+  getExpressTime() const
+  {
+    return m_expressTime;
+  }
+
   /**
    * @brief Record that the Interest has been forwarded to one destination.
    *
@@ -165,6 +180,11 @@ private:
   void
   invokeTimeoutCallback()
   {
+    if (m_origin == PendingInterestOrigin::APP) {
+      ++m_counters->nTimedOutInterests;
+      util::PacketTracer::record(util::PacketTraceEvent::TIMED_OUT, m_interest->getName(), 0, getId());
+    }
+
     if (m_timeoutCallback) {
       m_timeoutCallback(*m_interest);
     }
@@ -175,9 +195,11 @@ private:
 private:
   shared_ptr<const Interest> m_interest;
   PendingInterestOrigin m_origin;
-  DataCallback m_dataCallback;
-  NackCallback m_nackCallback;
-  TimeoutCallback m_timeoutCallback;
+  time::steady_clock::time_point m_expressTime;
+  detail::UniqueDataCallback m_dataCallback;
+  detail::UniqueNackCallback m_nackCallback;
+  detail::UniqueTimeoutCallback m_timeoutCallback;
+  FaceCounters* m_counters = nullptr;
   scheduler::ScopedEventId m_timeoutEvent;
   int m_nNotNacked = 0; ///< number of Interest destinations that have not Nacked
   std::optional<lp::Nack> m_leastSevereNack;
@@ -98,6 +98,7 @@ public:
     BOOST_ASSERT(id != 0);
     auto [it, isNew] = m_container.try_emplace(id, std::forward<decltype(args)>(args)...);
     BOOST_VERIFY(isNew);
+    updateSize();
 
     Record& record = it->second;
     record.m_container = this;
@@ -125,6 +126,7 @@ public:
   erase(RecordId id)
   {
     m_container.erase(id);
+    updateSize();
     if (empty()) {
       this->onEmpty();
     }
@@ -134,6 +136,7 @@ public:
   clear()
   {
     m_container.clear();
+    updateSize();
     this->onEmpty();
   }
 
@@ -154,6 +157,7 @@ public:
         ++i;
       }
     }
+    updateSize();
     if (empty()) {
       this->onEmpty();
     }
@@ -179,10 +183,13 @@ public:
     return m_container.empty();
   }
 
+  /** \brief Return the number of records.
+   *  \note This method can be called from any thread.
+   */
   size_t
   size() const noexcept
   {
-    return m_container.size();
+    return m_size.load(std::memory_order_relaxed);
   }
 
 public:
@@ -190,9 +197,17 @@ public:
    */
   signal::Signal<RecordContainer<T>> onEmpty;
 
+private:
+  void
+  updateSize() noexcept
+  {
+    m_size.store(m_container.size(), std::memory_order_relaxed);
+  }
+
 private:
   Container m_container;
   std::atomic<RecordId> m_lastId{0};
+  std::atomic<size_t> m_size{0};
 };
 
 } // namespace ndn::detail
@@ -0,0 +1,414 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/disk-storage.hpp"
+#include "ndn-cxx/encoding/tlv.hpp"
+
+#include <cstring>
+#include <filesystem>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ndn {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char SEGMENT_MAGIC[8] = {'N', 'D', 'N', 'I', 'M', 'S', 'S', 'G'};
+constexpr char INDEX_MAGIC[8] = {'N', 'D', 'N', 'I', 'M', 'S', 'I', 'X'};
+constexpr uint32_t FORMAT_VERSION = 1;
+constexpr uint64_t INITIAL_FILE_SIZE = 64 * 1024;
+constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+constexpr uint32_t FLAG_ERASED = 1;
+
+struct FileHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t recordSize;
+  /// segment file: number of octets used, including this header; index file: number of records
+  uint64_t used;
+};
+
+static_assert(sizeof(FileHeader) == 24);
+
+/**
+ * @brief Computes a hash of @p name that is stable across processes and platforms.
+ *
+ * This is the 64-bit FNV-1a hash of the TLV-VALUE of the Name element.
+ */
+uint64_t
+hashName(const Name& name)
+{
+  uint64_t hash = 0xcbf29ce484222325;
+  for (const auto& component : name) {
+    const auto& wire = component.wireEncode();
+    for (auto b : make_span(wire.data(), wire.size())) {
+      hash = (hash ^ b) * 0x100000001b3;
+    }
+  }
+  return hash;
+}
+
+} // namespace
+
+struct DiskStorage::IndexRecord
+{
+  uint64_t nameHash; ///< hashName() of the Data name without implicit digest
+  uint64_t offset;   ///< position of the Data in the segment file
+  uint32_t length;   ///< size of the Data wire encoding
+  uint32_t flags;
+  uint8_t digest[32]; ///< implicit SHA-256 digest of the Data
+};
+
+/**
+ * @brief A file mapped into memory in its entirety, starting with a FileHeader.
+ */
+class DiskStorage::MappedFile : noncopyable
+{
+public:
+  MappedFile(const fs::path& path, const char (&magic)[8], uint32_t recordSize)
+  {
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (m_fd < 0) {
+      NDN_THROW_ERRNO(Error("Cannot open " + path.string()));
+    }
+
+    struct stat st;
+    if (::fstat(m_fd, &st) != 0) {
+      ::close(m_fd);
+      NDN_THROW_ERRNO(Error("Cannot stat " + path.string()));
+    }
+
+    try {
+      if (st.st_size == 0) {
+        remap(INITIAL_FILE_SIZE);
+        auto& hdr = header();
+        std::memcpy(hdr.magic, magic, sizeof(hdr.magic));
+        hdr.version = FORMAT_VERSION;
+        hdr.recordSize = recordSize;
+        hdr.used = recordSize == 0 ? sizeof(FileHeader) : 0;
+        return;
+      }
+
+      if (static_cast<uint64_t>(st.st_size) < sizeof(FileHeader)) {
+        NDN_THROW(Error(path.string() + " is truncated"));
+      }
+      remap(static_cast<uint64_t>(st.st_size));
+      const auto& hdr = header();
+      if (std::memcmp(hdr.magic, magic, sizeof(hdr.magic)) != 0) {
+        NDN_THROW(Error(path.string() + " is not a DiskStorage file"));
+      }
+      if (hdr.version != FORMAT_VERSION || hdr.recordSize != recordSize) {
+        NDN_THROW(Error(path.string() + " has unsupported format version " +
+                        to_string(hdr.version)));
+      }
+    }
+    catch (const Error&) {
+      unmap();
+      ::close(m_fd);
+      throw;
+    }
+  }
+
+  ~MappedFile()
+  {
+    unmap();
+    ::close(m_fd);
+  }
+
+  FileHeader&
+  header() const noexcept
+  {
+    return *reinterpret_cast<FileHeader*>(m_base);
+  }
+
+  uint8_t*
+  data() const noexcept
+  {
+    return m_base;
+  }
+
+  uint64_t
+  capacity() const noexcept
+  {
+    return m_capacity;
+  }
+
+  /**
+   * @brief Grows the file, if necessary, so that it has at least @p nOctets.
+   * @warning Invalidates all pointers into the mapping.
+   */
+  void
+  reserve(uint64_t nOctets)
+  {
+    if (nOctets > m_capacity) {
+      remap(std::max(nOctets, m_capacity * 2));
+    }
+  }
+
+private:
+  void
+  remap(uint64_t size)
+  {
+    if (size > m_capacity && ::ftruncate(m_fd, static_cast<off_t>(size)) != 0) {
+      NDN_THROW_ERRNO(Error("Cannot grow DiskStorage file"));
+    }
+
+    void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (base == MAP_FAILED) {
+      NDN_THROW_ERRNO(Error("Cannot map DiskStorage file"));
+    }
+    unmap();
+    m_base = static_cast<uint8_t*>(base);
+    m_capacity = size;
+  }
+
+  void
+  unmap() noexcept
+  {
+    if (m_base != nullptr) {
+      ::munmap(m_base, m_capacity);
+      m_base = nullptr;
+    }
+  }
+
+private:
+  int m_fd = -1;
+  uint8_t* m_base = nullptr;
+  uint64_t m_capacity = 0;
+};
+
+DiskStorage::DiskStorage(const std::string& dir)
+{
+  static_assert(sizeof(IndexRecord) == 56);
+  static_assert(std::is_trivially_copyable_v<IndexRecord>);
+
+  std::error_code ec;
+  fs::create_directories(dir, ec);
+  if (ec) {
+    NDN_THROW(Error("Cannot create directory " + dir + ": " + ec.message()));
+  }
+
+  m_segment = make_unique<MappedFile>(fs::path(dir) / "packets.seg", SEGMENT_MAGIC, 0);
+  m_index = make_unique<MappedFile>(fs::path(dir) / "packets.idx", INDEX_MAGIC,
+                                    sizeof(IndexRecord));
+
+  auto segmentSize = std::min(m_segment->header().used, m_segment->capacity());
+  auto& nRecords = m_index->header().used;
+  nRecords = std::min(nRecords, (m_index->capacity() - sizeof(FileHeader)) / sizeof(IndexRecord));
+
+  m_table.reserve(nRecords);
+  for (size_t i = 0; i < nRecords; ++i) {
+    const auto& record = getRecord(i);
+    if ((record.flags & FLAG_ERASED) == 0 && record.offset >= sizeof(FileHeader) &&
+        record.offset + record.length <= segmentSize) {
+      m_table.emplace(record.nameHash, i);
+    }
+  }
+}
+
+DiskStorage::~DiskStorage() = default;
+
+const DiskStorage::IndexRecord&
+DiskStorage::getRecord(size_t i) const
+{
+  return reinterpret_cast<const IndexRecord*>(m_index->data() + sizeof(FileHeader))[i];
+}
+
+DiskStorage::IndexRecord&
+DiskStorage::getRecord(size_t i)
+{
+  return reinterpret_cast<IndexRecord*>(m_index->data() + sizeof(FileHeader))[i];
+}
+
+Block
+DiskStorage::readBlock(const IndexRecord& record) const
+{
+  // copy the packet out of the mapping, which is invalidated when the file grows
+  return Block(make_span(m_segment->data() + record.offset, record.length));
+}
+
+template<typename Pred>
+size_t
+DiskStorage::findRecord(uint64_t hash, const Pred& f) const
+{
+  auto range = m_table.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (f(getRecord(it->second))) {
+      return it->second;
+    }
+  }
+  return NOT_FOUND;
+}
+
+size_t
+DiskStorage::findFullName(const Name& fullName) const
+{
+  const auto& digest = fullName[-1];
+  if (digest.value_size() != sizeof(IndexRecord::digest)) {
+    return NOT_FOUND;
+  }
+
+  return findRecord(hashName(fullName.getPrefix(-1)), [&] (const IndexRecord& record) {
+    return std::memcmp(record.digest, digest.value(), sizeof(record.digest)) == 0;
+  });
+}
+
+bool
+DiskStorage::insert(const Data& data)
+{
+  const auto& fullName = data.getFullName();
+  if (findFullName(fullName) != NOT_FOUND) {
+    return false;
+  }
+
+  const auto& wire = data.wireEncode();
+  auto offset = m_segment->header().used;
+  m_segment->reserve(offset + wire.size());
+  std::memcpy(m_segment->data() + offset, wire.data(), wire.size());
+  m_segment->header().used = offset + wire.size();
+
+  auto i = static_cast<size_t>(m_index->header().used);
+  m_index->reserve(sizeof(FileHeader) + (i + 1) * sizeof(IndexRecord));
+  auto& record = getRecord(i);
+  record.nameHash = hashName(data.getName());
+  record.offset = offset;
+  record.length = static_cast<uint32_t>(wire.size());
+  record.flags = 0;
+  std::memcpy(record.digest, fullName[-1].value(), sizeof(record.digest));
+  m_index->header().used = i + 1;
+
+  m_table.emplace(record.nameHash, i);
+  return true;
+}
+
+shared_ptr<Data>
+DiskStorage::find(const Interest& interest) const
+{
+  if (interest.getMustBeFresh()) {
+    return nullptr;
+  }
+
+  const auto& name = interest.getName();
+  if (!name.empty() && name[-1].isImplicitSha256Digest()) {
+    auto i = findFullName(name);
+    if (i != NOT_FOUND) {
+      auto data = make_shared<Data>(readBlock(getRecord(i)));
+      return interest.matchesData(*data) ? data : nullptr;
+    }
+  }
+
+  shared_ptr<Data> match;
+  findRecord(hashName(name), [&] (const IndexRecord& record) {
+    auto data = make_shared<Data>(readBlock(record));
+    if (data->getName() == name && interest.matchesData(*data)) {
+      match = std::move(data);
+      return true;
+    }
+    return false;
+  });
+  return match;
+}
+
+shared_ptr<Data>
+DiskStorage::find(const Name& name) const
+{
+  if (!name.empty() && name[-1].isImplicitSha256Digest()) {
+    auto i = findFullName(name);
+    if (i != NOT_FOUND) {
+      return make_shared<Data>(readBlock(getRecord(i)));
+    }
+  }
+
+  shared_ptr<Data> match;
+  findRecord(hashName(name), [&] (const IndexRecord& record) {
+    auto data = make_shared<Data>(readBlock(record));
+    if (data->getName() == name) {
+      match = std::move(data);
+      return true;
+    }
+    return false;
+  });
+  return match;
+}
+
+void
+DiskStorage::erase(const Name& prefix, bool isPrefix)
+{
+  if (!isPrefix) {
+    if (!prefix.empty() && prefix[-1].isImplicitSha256Digest()) {
+      auto i = findFullName(prefix);
+      if (i != NOT_FOUND) {
+        eraseRecord(i);
+      }
+    }
+    return;
+  }
+
+  std::vector<size_t> erased;
+  for (const auto& [hash, i] : m_table) {
+    // decode only the Name element, which is the first element of the Data
+    const auto& record = getRecord(i);
+    auto pos = m_segment->data() + record.offset;
+    auto end = pos + record.length;
+    uint32_t type = 0;
+    uint64_t length = 0;
+    if (!tlv::readType(pos, end, type) || !tlv::readVarNumber(pos, end, length)) {
+      continue;
+    }
+    auto [isOk, nameBlock] = Block::fromBuffer(make_span(pos, static_cast<size_t>(end - pos)));
+    if (isOk && prefix.isPrefixOf(Name(nameBlock))) {
+      erased.push_back(i);
+    }
+  }
+
+  for (auto i : erased) {
+    eraseRecord(i);
+  }
+}
+
+void
+DiskStorage::eraseRecord(size_t i)
+{
+  auto& record = getRecord(i);
+  record.flags |= FLAG_ERASED;
+
+  auto range = m_table.equal_range(record.nameHash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == i) {
+      m_table.erase(it);
+      return;
+    }
+  }
+}
+
+uint64_t
+DiskStorage::getSegmentSize() const
+{
+  return m_segment->header().used;
+}
+
+} // namespace ndn
@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMS_DISK_STORAGE_HPP
+#define NDN_CXX_IMS_DISK_STORAGE_HPP
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/interest.hpp"
+
+#include <unordered_map>
+
+namespace ndn {
+
+/**
+ * @brief Stores Data packets in an append-only, memory-mapped file.
+ *
+ * The storage consists of two files in a directory: a segment file that holds the wire
+ * encodings of the packets back to back, and an index file with one fixed-size record per
+ * packet, containing a hash of the packet name, the implicit digest, and the location of the
+ * packet in the segment file. Both files are memory-mapped. When the storage is opened, only
+ * the index is scanned to rebuild the in-memory hash table, so that reopening a large storage
+ * does not read or decode any packet.
+ *
+ * Packets are looked up by exact name, with or without implicit digest. Erased packets are only
+ * marked as such in the index; the space they occupy in the segment file is not reclaimed.
+ *
+ * @note The files are not synchronized to stable storage explicitly. Their contents survive
+ *       a crash of the process, but not necessarily a crash of the operating system.
+ */
+class DiskStorage : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @brief Open the storage in @p dir, creating the directory and the files if necessary.
+   * @throw Error the files cannot be opened or are not valid
+   */
+  explicit
+  DiskStorage(const std::string& dir);
+
+  ~DiskStorage();
+
+  /**
+   * @brief Appends a Data packet.
+   * @return false if the packet, identified by its full name, is already stored
+   * @throw Error the packet cannot be written
+   */
+  bool
+  insert(const Data& data);
+
+  /**
+   * @brief Finds a Data packet whose name is equal to the Interest name.
+   *
+   * Stored packets have no freshness information, so Interests with MustBeFresh are never
+   * satisfied. Interests with CanBePrefix are only satisfied by a packet whose name is equal
+   * to the Interest name.
+   *
+   * @return the match, if any; otherwise a null shared_ptr
+   */
+  shared_ptr<Data>
+  find(const Interest& interest) const;
+
+  /**
+   * @brief Finds a Data packet by name with or without implicit digest.
+   *
+   * If several packets have the name supplied without implicit digest, one of them is returned.
+   *
+   * @return the match, if any; otherwise a null shared_ptr
+   */
+  shared_ptr<Data>
+  find(const Name& name) const;
+
+  /**
+   * @brief Erases packets under @p prefix, or with full name @p prefix if @p isPrefix is false.
+   *
+   * Erasing by prefix reads the name of every stored packet.
+   */
+  void
+  erase(const Name& prefix, bool isPrefix = true);
+
+  /**
+   * @brief Returns the number of stored packets that have not been erased.
+   */
+  size_t
+  size() const
+  {
+    return m_table.size();
+  }
+
+  /**
+   * @brief Returns the number of octets used in the segment file, including erased packets.
+   */
+  uint64_t
+  getSegmentSize() const;
+
+private:
+  class MappedFile;
+  struct IndexRecord;
+
+  const IndexRecord&
+  getRecord(size_t i) const;
+
+  IndexRecord&
+  getRecord(size_t i);
+
+  Block
+  readBlock(const IndexRecord& record) const;
+
+  /**
+   * @brief Calls @p f for each live record whose name hash is @p hash, until it returns true.
+   * @return the index of the record for which @p f returned true, or size_t(-1)
+   */
+  template<typename Pred>
+  size_t
+  findRecord(uint64_t hash, const Pred& f) const;
+
+  size_t
+  findFullName(const Name& fullName) const;
+
+  size_t
+  findName(const Name& name) const;
+
+  void
+  eraseRecord(size_t i);
+
+private:
+  unique_ptr<MappedFile> m_segment;
+  unique_ptr<MappedFile> m_index;
+  /// name hash => record number, for all records that have not been erased
+  std::unordered_multimap<uint64_t, size_t> m_table;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_IMS_DISK_STORAGE_HPP
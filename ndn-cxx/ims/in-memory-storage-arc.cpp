@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-arc.hpp"
+
+namespace ndn {
+
+static size_t
+getNameHash(const InMemoryStorageEntry* entry)
+{
+  return std::hash<Name>{}(entry->getName());
+}
+
+InMemoryStorageArc::InMemoryStorageArc(size_t limit)
+  : InMemoryStorage(limit)
+{
+}
+
+InMemoryStorageArc::InMemoryStorageArc(boost::asio::io_context& ioCtx, size_t limit)
+  : InMemoryStorage(ioCtx, limit)
+{
+}
+
+void
+InMemoryStorageArc::afterInsert(InMemoryStorageEntry* entry)
+{
+  BOOST_ASSERT(m_recent.size() + m_frequent.size() <= size());
+  size_t key = getNameHash(entry);
+  size_t c = size();
+
+  auto& recentGhost = m_recentGhost.get<byNameHash>();
+  auto& frequentGhost = m_frequentGhost.get<byNameHash>();
+  if (auto it = recentGhost.find(key); it != recentGhost.end()) {
+    // evicted too early from the recency list: favor recency
+    size_t delta = std::max<size_t>(1, m_frequentGhost.size() / m_recentGhost.size());
+    m_target = std::min(m_target + delta, c);
+    recentGhost.erase(it);
+    m_frequent.insert(entry);
+  }
+  else if (auto it = frequentGhost.find(key); it != frequentGhost.end()) {
+    // evicted too early from the frequency list: favor frequency
+    size_t delta = std::max<size_t>(1, m_recentGhost.size() / m_frequentGhost.size());
+    m_target = m_target > delta ? m_target - delta : 0;
+    frequentGhost.erase(it);
+    m_frequent.insert(entry);
+  }
+  else {
+    m_recent.insert(entry);
+  }
+
+  trimGhosts();
+}
+
+bool
+InMemoryStorageArc::evictItem()
+{
+  if (m_recent.empty() && m_frequent.empty()) {
+    return false;
+  }
+
+  bool isFromRecent = !m_recent.empty() && (m_recent.size() > m_target || m_frequent.empty());
+  auto& list = (isFromRecent ? m_recent : m_frequent).get<byUsedTime>();
+  auto& ghost = isFromRecent ? m_recentGhost : m_frequentGhost;
+
+  auto it = list.begin();
+  InMemoryStorageEntry* entry = *it;
+  ghost.get<byEvictionTime>().push_back(getNameHash(entry));
+  list.erase(it);
+  eraseImpl(entry->getFullName());
+  return true;
+}
+
+void
+InMemoryStorageArc::trimGhosts()
+{
+  // the recency list and its ghost list together remember at most c packets,
+  // and the ghost lists together remember at most c packets, where c is the number of
+  // resident packets; ghosts are trimmed only upon insertion, so that the packet being
+  // inserted is still remembered after a victim has been evicted to make room for it
+  size_t c = m_recent.size() + m_frequent.size();
+  while (!m_recentGhost.empty() && m_recent.size() + m_recentGhost.size() > c) {
+    m_recentGhost.get<byEvictionTime>().pop_front();
+  }
+  while (m_recentGhost.size() + m_frequentGhost.size() > c) {
+    auto& ghost = m_frequentGhost.empty() ? m_recentGhost : m_frequentGhost;
+    ghost.get<byEvictionTime>().pop_front();
+  }
+}
+
+void
+InMemoryStorageArc::beforeErase(InMemoryStorageEntry* entry)
+{
+  if (m_recent.get<byEntity>().erase(entry) == 0) {
+    m_frequent.get<byEntity>().erase(entry);
+  }
+}
+
+void
+InMemoryStorageArc::afterAccess(InMemoryStorageEntry* entry)
+{
+  beforeErase(entry);
+  m_frequent.insert(entry);
+}
+
+} // namespace ndn
@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMS_IN_MEMORY_STORAGE_ARC_HPP
+#define NDN_CXX_IMS_IN_MEMORY_STORAGE_ARC_HPP
+
+#include "ndn-cxx/ims/in-memory-storage.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/identity.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+
+namespace ndn {
+
+/**
+ * @brief Provides in-memory storage employing Adaptive Replacement Cache (ARC) policy.
+ *
+ * ARC keeps resident packets in two LRU lists: packets accessed once since insertion
+ * (recency list) and packets accessed more than once (frequency list). It also remembers
+ * the names of packets recently evicted from each list (ghost lists). Re-insertion of a packet
+ * found in a ghost list adapts the target size of the recency list, so that the policy
+ * balances recency and frequency according to the workload. A single sequential scan only
+ * flushes the recency list, leaving frequently accessed packets in the cache.
+ *
+ * Packets are identified in the ghost lists by the hash of their name without implicit digest.
+ *
+ * @note Unlike the original algorithm, the target size is adapted after a victim has been
+ *       chosen for the insertion that hits a ghost list, because InMemoryStorage calls
+ *       evictItem() before it knows which packet is being inserted.
+ */
+class InMemoryStorageArc : public InMemoryStorage
+{
+public:
+  explicit
+  InMemoryStorageArc(size_t limit = 16);
+
+  explicit
+  InMemoryStorageArc(boost::asio::io_context& ioCtx, size_t limit = 16);
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PROTECTED:
+  /** @brief Removes the least recently used Data packet from the recency list if it exceeds
+   *  its target size, otherwise from the frequency list, and remembers it in a ghost list
+   *  @return{ whether the Data was removed }
+   */
+  bool
+  evictItem() override;
+
+  /** @brief Move the entry to the most recently used end of the frequency list
+   */
+  void
+  afterAccess(InMemoryStorageEntry* entry) override;
+
+  /** @brief Add the entry to the recency list, or to the frequency list if it is in a ghost
+   *  list, adapting the target size of the recency list
+   */
+  void
+  afterInsert(InMemoryStorageEntry* entry) override;
+
+  /** @brief Remove the entry from the recency or frequency list
+   */
+  void
+  beforeErase(InMemoryStorageEntry* entry) override;
+
+private:
+  void
+  trimGhosts();
+
+private:
+  // multi_index_container to implement LRU lists of resident entries
+  class byUsedTime;
+  class byEntity;
+
+  using CleanupIndex = boost::multi_index_container<
+    InMemoryStorageEntry*,
+    boost::multi_index::indexed_by<
+      // by Entry itself
+      boost::multi_index::hashed_unique<
+        boost::multi_index::tag<byEntity>,
+        boost::multi_index::identity<InMemoryStorageEntry*>
+      >,
+      // by last used time (LRU)
+      boost::multi_index::sequenced<
+        boost::multi_index::tag<byUsedTime>
+      >
+    >
+  >;
+
+  // multi_index_container to implement LRU lists of evicted entries
+  class byNameHash;
+  class byEvictionTime;
+
+  using GhostIndex = boost::multi_index_container<
+    size_t,
+    boost::multi_index::indexed_by<
+      // by hash of the Name
+      boost::multi_index::hashed_unique<
+        boost::multi_index::tag<byNameHash>,
+        boost::multi_index::identity<size_t>
+      >,
+      // by eviction time
+      boost::multi_index::sequenced<
+        boost::multi_index::tag<byEvictionTime>
+      >
+    >
+  >;
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  CleanupIndex m_recent;
+  CleanupIndex m_frequent;
+  GhostIndex m_recentGhost;
+  GhostIndex m_frequentGhost;
+  /// target size of the recency list
+  size_t m_target = 0;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_IMS_IN_MEMORY_STORAGE_ARC_HPP
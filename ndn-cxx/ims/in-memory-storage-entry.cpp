@@ -23,17 +23,21 @@
 
 namespace ndn {
 
-void
-InMemoryStorageEntry::release()
+// decoded Data packet, entry itself, and nodes in the three indexes of InMemoryStorage::Cache
+// and in the queue of a replacement policy
+constexpr size_t ENTRY_OVERHEAD = sizeof(Data) + sizeof(InMemoryStorageEntry) + 12 * sizeof(void*);
+
+size_t
+InMemoryStorageEntry::computeSize(const Data& data)
 {
-  m_dataPacket.reset();
-  m_markStaleEventId.cancel();
+  return data.wireEncode().size() + ENTRY_OVERHEAD;
 }
 
 void
-InMemoryStorageEntry::scheduleMarkStale(Scheduler& sched, time::nanoseconds after)
+InMemoryStorageEntry::release()
 {
-  m_markStaleEventId = sched.schedule(after, [this] { m_isFresh = false; });
+  m_dataPacket.reset();
+  m_size = 0;
 }
 
 } // namespace ndn
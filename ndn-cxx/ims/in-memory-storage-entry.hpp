@@ -24,7 +24,7 @@
 
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/interest.hpp"
-#include "ndn-cxx/util/scheduler.hpp"
+#include "ndn-cxx/util/time.hpp"
 
 namespace ndn {
 
@@ -67,21 +67,45 @@ public:
   setData(const Data& data)
   {
     m_dataPacket = data.shared_from_this();
-    m_isFresh = true;
+    m_size = computeSize(data);
+    m_staleTime = time::steady_clock::time_point::max();
   }
 
-  /** @brief Schedule an event to mark this entry as non-fresh.
+  /** @brief Returns the number of octets accounted for this entry
+   */
+  size_t
+  getSize() const
+  {
+    return m_size;
+  }
+
+  /** @brief Returns the number of octets accounted for an entry holding @p data
+   *
+   *  This is the size of the wire encoding of @p data, plus an estimate of the memory
+   *  used by the decoded Data packet and by the bookkeeping structures of InMemoryStorage.
+   */
+  static size_t
+  computeSize(const Data& data);
+
+  /** @brief Set the time at which this entry becomes non-fresh.
    */
   void
-  scheduleMarkStale(Scheduler& sched, time::nanoseconds after);
+  setStaleTime(time::steady_clock::time_point staleTime)
+  {
+    m_staleTime = staleTime;
+  }
 
   /**
    * @brief Check if the data can satisfy an Interest with MustBeFresh.
+   *
+   * Freshness is evaluated lazily against the current time, so that no timer is needed
+   * to mark the entry as non-fresh.
    */
   bool
   isFresh() const
   {
-    return m_isFresh;
+    return m_staleTime == time::steady_clock::time_point::max() ||
+           time::steady_clock::now() < m_staleTime;
   }
 
   /**
@@ -92,8 +116,8 @@ public:
 
 private:
   shared_ptr<const Data> m_dataPacket;
-  scheduler::ScopedEventId m_markStaleEventId;
-  bool m_isFresh = true;
+  time::steady_clock::time_point m_staleTime = time::steady_clock::time_point::max();
+  size_t m_size = 0;
 };
 
 } // namespace ndn
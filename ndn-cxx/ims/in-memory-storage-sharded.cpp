@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-sharded.hpp"
+
+namespace ndn {
+
+InMemoryStorageSharded::InMemoryStorageSharded(size_t nShards, const ShardFactory& makeShard)
+  : m_shards(nShards)
+{
+  if (nShards == 0) {
+    NDN_THROW(std::invalid_argument("Number of shards must be positive"));
+  }
+
+  for (auto& shard : m_shards) {
+    shard.ims = makeShard();
+    BOOST_ASSERT(shard.ims != nullptr);
+  }
+}
+
+size_t
+InMemoryStorageSharded::getShardIndex(const Name& dataName) const
+{
+  return std::hash<Name>{}(dataName) % m_shards.size();
+}
+
+size_t
+InMemoryStorageSharded::getShardIndexForExactName(const Name& name) const
+{
+  if (!name.empty() && name[-1].isImplicitSha256Digest()) {
+    return getShardIndex(name.getPrefix(-1));
+  }
+  return getShardIndex(name);
+}
+
+void
+InMemoryStorageSharded::insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow)
+{
+  auto& shard = m_shards[getShardIndex(data.getName())];
+  std::lock_guard lock(shard.mutex);
+  shard.ims->insert(data, mustBeFreshProcessingWindow);
+}
+
+template<typename Probe>
+shared_ptr<const Data>
+InMemoryStorageSharded::findInAllShards(const Probe& probe)
+{
+  // the shard of the best match so far stays locked, so that its entry remains valid until the
+  // hit is counted; shards are always locked in index order, which rules out deadlocks
+  std::unique_lock<std::mutex> bestLock;
+  InMemoryStorage* bestIms = nullptr;
+  InMemoryStorageEntry* best = nullptr;
+  for (auto& shard : m_shards) {
+    std::unique_lock lock(shard.mutex);
+    InMemoryStorageEntry* entry = probe(*shard.ims);
+    if (entry != nullptr && (best == nullptr || entry->getFullName() < best->getFullName())) {
+      best = entry;
+      bestIms = shard.ims.get();
+      bestLock = std::move(lock);
+    }
+  }
+
+  if (best == nullptr) {
+    return nullptr;
+  }
+  bestIms->countHit(best);
+  return best->getData().shared_from_this();
+}
+
+void
+InMemoryStorageSharded::countMiss(const Name& name, bool isStaleHit)
+{
+  auto& shard = m_shards[getShardIndexForExactName(name)];
+  std::lock_guard lock(shard.mutex);
+  shard.ims->countMiss(isStaleHit);
+}
+
+shared_ptr<const Data>
+InMemoryStorageSharded::find(const Interest& interest)
+{
+  if (!interest.getCanBePrefix()) {
+    // the Interest name is either the Data name or the Data full name
+    auto& shard = m_shards[getShardIndexForExactName(interest.getName())];
+    std::lock_guard lock(shard.mutex);
+    return shard.ims->find(interest);
+  }
+
+  auto found = findInAllShards([&interest] (const InMemoryStorage& ims) {
+    return ims.findEntry(interest);
+  });
+  if (found == nullptr) {
+    bool isStaleHit = false;
+    if (interest.getMustBeFresh()) {
+      for (auto& shard : m_shards) {
+        std::lock_guard lock(shard.mutex);
+        if (shard.ims->isFreshnessTracked() && shard.ims->findEntry(interest, true) != nullptr) {
+          isStaleHit = true;
+          break;
+        }
+      }
+    }
+    countMiss(interest.getName(), isStaleHit);
+  }
+  return found;
+}
+
+shared_ptr<const Data>
+InMemoryStorageSharded::find(const Name& name)
+{
+  {
+    // an exact match on the name or the full name is preferred, as in InMemoryStorage
+    auto& shard = m_shards[getShardIndexForExactName(name)];
+    std::lock_guard lock(shard.mutex);
+    auto entry = shard.ims->findEntry(name);
+    if (entry != nullptr && (entry->getName() == name || entry->getFullName() == name)) {
+      shard.ims->countHit(entry);
+      return entry->getData().shared_from_this();
+    }
+  }
+
+  auto found = findInAllShards([&name] (const InMemoryStorage& ims) {
+    return ims.findEntry(name);
+  });
+  if (found == nullptr) {
+    countMiss(name);
+  }
+  return found;
+}
+
+void
+InMemoryStorageSharded::erase(const Name& prefix, bool isPrefix)
+{
+  if (!isPrefix && !prefix.empty() && prefix[-1].isImplicitSha256Digest()) {
+    auto& shard = m_shards[getShardIndex(prefix.getPrefix(-1))];
+    std::lock_guard lock(shard.mutex);
+    shard.ims->erase(prefix, false);
+    return;
+  }
+
+  for (auto& shard : m_shards) {
+    std::lock_guard lock(shard.mutex);
+    shard.ims->erase(prefix, isPrefix);
+  }
+}
+
+void
+InMemoryStorageSharded::setByteLimit(size_t nBytes)
+{
+  size_t perShard = nBytes / m_shards.size();
+  for (auto& shard : m_shards) {
+    std::lock_guard lock(shard.mutex);
+    shard.ims->setByteLimit(perShard);
+  }
+}
+
+size_t
+InMemoryStorageSharded::size() const
+{
+  size_t n = 0;
+  for (const auto& shard : m_shards) {
+    std::lock_guard lock(shard.mutex);
+    n += shard.ims->size();
+  }
+  return n;
+}
+
+size_t
+InMemoryStorageSharded::getNBytes() const
+{
+  size_t n = 0;
+  for (const auto& shard : m_shards) {
+    std::lock_guard lock(shard.mutex);
+    n += shard.ims->getNBytes();
+  }
+  return n;
+}
+
+} // namespace ndn
@@ -0,0 +1,164 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
+#define NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
+
+#include "ndn-cxx/ims/in-memory-storage.hpp"
+
+#include <functional>
+#include <mutex>
+
+namespace ndn {
+
+/**
+ * @brief Provides thread-safe in-memory storage, split into independently locked shards.
+ *
+ * Each Data packet is stored in one of several sub-stores (shards), selected by the hash of
+ * the Data name. Each shard is an InMemoryStorage with its own replacement policy and limits,
+ * protected by its own mutex, so that threads operating on packets in different shards do not
+ * contend with each other.
+ *
+ * Lookups by exact name, i.e., Interests without CanBePrefix and names with or without implicit
+ * digest, lock only one shard. Interests with CanBePrefix and prefix erasure visit all shards;
+ * among matches from different shards, the one that comes first in canonical order is returned,
+ * as in a single InMemoryStorage. Each lookup is counted once: as a hit in the shard of the
+ * returned packet, or otherwise as a miss in the shard of the looked-up name.
+ *
+ * MustBeFresh is handled if the shards are created with an io_context. Because freshness is
+ * evaluated lazily upon lookup, the io_context does not need to be run by any particular thread.
+ */
+class InMemoryStorageSharded : noncopyable
+{
+public:
+  /**
+   * @brief Function to create the InMemoryStorage of a shard.
+   */
+  using ShardFactory = std::function<unique_ptr<InMemoryStorage>()>;
+
+  /**
+   * @brief Create a sharded storage.
+   * @param nShards number of shards, must be positive
+   * @param makeShard function to create each shard, e.g., an InMemoryStorageLru with the
+   *                  desired per-shard limit
+   * @throw std::invalid_argument @p nShards is zero
+   */
+  InMemoryStorageSharded(size_t nShards, const ShardFactory& makeShard);
+
+  /**
+   * @brief Inserts a Data packet into its shard.
+   * @sa InMemoryStorage::insert
+   */
+  void
+  insert(const Data& data,
+         const time::milliseconds& mustBeFreshProcessingWindow = InMemoryStorage::INFINITE_WINDOW);
+
+  /**
+   * @brief Finds the best match Data for an Interest.
+   * @sa InMemoryStorage::find(const Interest&)
+   */
+  shared_ptr<const Data>
+  find(const Interest& interest);
+
+  /**
+   * @brief Finds the best match Data for a Name with or without implicit digest.
+   * @sa InMemoryStorage::find(const Name&)
+   */
+  shared_ptr<const Data>
+  find(const Name& name);
+
+  /**
+   * @brief Deletes entries by prefix, or by full name if @p isPrefix is false.
+   * @sa InMemoryStorage::erase
+   */
+  void
+  erase(const Name& prefix, bool isPrefix = true);
+
+  /**
+   * @brief Limits the memory used by packets, split evenly among the shards.
+   * @sa InMemoryStorage::setByteLimit
+   */
+  void
+  setByteLimit(size_t nBytes);
+
+  /**
+   * @return Number of packets stored in all shards.
+   */
+  size_t
+  size() const;
+
+  /**
+   * @return Number of octets used by packets stored in all shards.
+   */
+  size_t
+  getNBytes() const;
+
+  size_t
+  getNShards() const noexcept
+  {
+    return m_shards.size();
+  }
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /**
+   * @brief Returns the index of the shard that stores Data packets named @p dataName.
+   */
+  size_t
+  getShardIndex(const Name& dataName) const;
+
+private:
+  /**
+   * @brief Returns the index of the only shard that can contain a Data whose name or full name
+   *        is @p name.
+   */
+  size_t
+  getShardIndexForExactName(const Name& name) const;
+
+  /**
+   * @brief Invokes @p probe on each shard and returns the match that comes first in
+   *        canonical order.
+   *
+   * Only the shard of the returned match counts a hit. Nothing is counted if there is no match.
+   */
+  template<typename Probe>
+  shared_ptr<const Data>
+  findInAllShards(const Probe& probe);
+
+  /**
+   * @brief Counts a lookup of @p name that returned no packet, in the shard of @p name.
+   */
+  void
+  countMiss(const Name& name, bool isStaleHit = false);
+
+private:
+  // aligned to avoid false sharing between mutexes of neighboring shards
+  struct alignas(64) Shard
+  {
+    mutable std::mutex mutex;
+    unique_ptr<InMemoryStorage> ims;
+  };
+
+  std::vector<Shard> m_shards;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
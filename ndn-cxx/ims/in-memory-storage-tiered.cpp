@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-tiered.hpp"
+
+namespace ndn {
+
+InMemoryStorageTiered::InMemoryStorageTiered(unique_ptr<InMemoryStorage> memory,
+                                             const std::string& dir)
+  : m_memory(std::move(memory))
+  , m_disk(dir)
+{
+  if (m_memory == nullptr || !m_memory->isFreshnessTracked()) {
+    // a memory tier that ignores MustBeFresh would serve promoted packets as fresh
+    NDN_THROW(std::invalid_argument("The memory tier must be created with an io_context"));
+  }
+  m_evictConn = m_memory->beforeEvict.connect([this] (const Data& data) { spill(data); });
+}
+
+void
+InMemoryStorageTiered::insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow)
+{
+  m_memory->insert(data, mustBeFreshProcessingWindow);
+}
+
+shared_ptr<const Data>
+InMemoryStorageTiered::find(const Interest& interest)
+{
+  auto data = m_memory->find(interest);
+  if (data != nullptr) {
+    return data;
+  }
+
+  auto diskData = m_disk.find(interest);
+  if (diskData != nullptr) {
+    promote(*diskData);
+  }
+  return diskData;
+}
+
+shared_ptr<const Data>
+InMemoryStorageTiered::find(const Name& name)
+{
+  auto data = m_memory->find(name);
+  if (data != nullptr) {
+    return data;
+  }
+
+  auto diskData = m_disk.find(name);
+  if (diskData != nullptr) {
+    promote(*diskData);
+  }
+  return diskData;
+}
+
+void
+InMemoryStorageTiered::erase(const Name& prefix, bool isPrefix)
+{
+  m_memory->erase(prefix, isPrefix);
+  m_disk.erase(prefix, isPrefix);
+}
+
+void
+InMemoryStorageTiered::flush()
+{
+  if (m_memory->size() == 0) {
+    return;
+  }
+
+  for (const auto& data : *m_memory) {
+    m_disk.insert(data);
+  }
+}
+
+void
+InMemoryStorageTiered::spill(const Data& data)
+{
+  try {
+    m_disk.insert(data);
+  }
+  catch (const DiskStorage::Error&) {
+    // the packet is dropped, as if there were no disk tier
+  }
+}
+
+void
+InMemoryStorageTiered::promote(const Data& data)
+{
+  // the disk tier does not track freshness, so the promoted packet is stale right away
+  m_memory->insert(data, 0_ms);
+}
+
+} // namespace ndn
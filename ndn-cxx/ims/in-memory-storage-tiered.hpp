@@ -0,0 +1,122 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMS_IN_MEMORY_STORAGE_TIERED_HPP
+#define NDN_CXX_IMS_IN_MEMORY_STORAGE_TIERED_HPP
+
+#include "ndn-cxx/ims/disk-storage.hpp"
+#include "ndn-cxx/ims/in-memory-storage.hpp"
+
+namespace ndn {
+
+/**
+ * @brief Provides two-tier storage: an InMemoryStorage backed by a DiskStorage.
+ *
+ * Packets are inserted into the memory tier. When the replacement policy of the memory tier
+ * evicts a packet, the packet is appended to the disk tier instead of being discarded. A lookup
+ * that misses the memory tier is tried against the disk tier; a packet found there is promoted
+ * back into the memory tier, where it is considered stale, and remains on disk as well.
+ *
+ * The disk tier outlives the process: a new InMemoryStorageTiered opened on the same directory
+ * can answer lookups for packets evicted or flushed by a previous one. Packets that are still
+ * in the memory tier are written to disk only by flush().
+ *
+ * @sa DiskStorage for the kinds of lookups that the disk tier can answer
+ */
+class InMemoryStorageTiered : noncopyable
+{
+public:
+  /**
+   * @brief Create a two-tier storage.
+   * @param memory the memory tier, e.g., an InMemoryStorageLru with the desired limits; it must
+   *               be created with an io_context, so that promoted packets can be stale
+   * @param dir directory of the disk tier, created if necessary
+   * @throw std::invalid_argument @p memory does not handle MustBeFresh
+   * @throw DiskStorage::Error the disk tier cannot be opened
+   */
+  InMemoryStorageTiered(unique_ptr<InMemoryStorage> memory, const std::string& dir);
+
+  /**
+   * @brief Inserts a Data packet into the memory tier.
+   * @sa InMemoryStorage::insert
+   */
+  void
+  insert(const Data& data,
+         const time::milliseconds& mustBeFreshProcessingWindow = InMemoryStorage::INFINITE_WINDOW);
+
+  /**
+   * @brief Finds the best match Data for an Interest, promoting a match found on disk.
+   * @sa InMemoryStorage::find(const Interest&)
+   */
+  shared_ptr<const Data>
+  find(const Interest& interest);
+
+  /**
+   * @brief Finds a Data packet by name with or without implicit digest, promoting a match
+   *        found on disk.
+   * @sa InMemoryStorage::find(const Name&)
+   */
+  shared_ptr<const Data>
+  find(const Name& name);
+
+  /**
+   * @brief Erases Data packets from both tiers.
+   * @sa InMemoryStorage::erase
+   */
+  void
+  erase(const Name& prefix, bool isPrefix = true);
+
+  /**
+   * @brief Writes all packets of the memory tier to the disk tier.
+   *
+   * Packets remain in the memory tier. Packets that are already on disk are not written again.
+   */
+  void
+  flush();
+
+  InMemoryStorage&
+  getMemoryTier() noexcept
+  {
+    return *m_memory;
+  }
+
+  DiskStorage&
+  getDiskTier() noexcept
+  {
+    return m_disk;
+  }
+
+private:
+  void
+  spill(const Data& data);
+
+  void
+  promote(const Data& data);
+
+private:
+  unique_ptr<InMemoryStorage> m_memory;
+  DiskStorage m_disk;
+  signal::ScopedConnection m_evictConn;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_IMS_IN_MEMORY_STORAGE_TIERED_HPP
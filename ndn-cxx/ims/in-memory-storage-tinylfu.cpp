@@ -0,0 +1,225 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-tinylfu.hpp"
+
+#include <algorithm>
+
+namespace ndn {
+
+static size_t
+getNameHash(const InMemoryStorageEntry* entry)
+{
+  return std::hash<Name>{}(entry->getName());
+}
+
+InMemoryStorageTinyLfu::FrequencySketch::FrequencySketch(size_t width)
+{
+  ensureWidth(width);
+}
+
+void
+InMemoryStorageTinyLfu::FrequencySketch::ensureWidth(size_t width)
+{
+  size_t roundedWidth = MIN_WIDTH;
+  while (roundedWidth < width) {
+    roundedWidth <<= 1;
+  }
+  if (roundedWidth <= m_width) {
+    return;
+  }
+
+  // a key's column in the narrower sketch is its column in the wider sketch modulo the old width,
+  // so copying each counter into all the columns that fold onto it keeps every estimate
+  std::vector<uint8_t> counters(DEPTH * roundedWidth);
+  if (m_width > 0) {
+    for (size_t row = 0; row < DEPTH; ++row) {
+      for (size_t col = 0; col < roundedWidth; ++col) {
+        counters[row * roundedWidth + col] = m_counters[row * m_width + (col & (m_width - 1))];
+      }
+    }
+  }
+  m_width = roundedWidth;
+  m_counters = std::move(counters);
+}
+
+size_t
+InMemoryStorageTinyLfu::FrequencySketch::getIndex(size_t key, size_t row) const noexcept
+{
+  static constexpr uint64_t SEEDS[DEPTH] = {
+    0x9e3779b97f4a7c15, 0xc2b2ae3d27d4eb4f, 0x165667b19e3779f9, 0x27d4eb2f165667c5,
+  };
+  uint64_t h = (static_cast<uint64_t>(key) + row) * SEEDS[row];
+  h ^= h >> 32;
+  return row * m_width + (h & (m_width - 1));
+}
+
+void
+InMemoryStorageTinyLfu::FrequencySketch::increment(size_t key) noexcept
+{
+  for (size_t row = 0; row < DEPTH; ++row) {
+    auto& counter = m_counters[getIndex(key, row)];
+    if (counter < MAX_COUNT) {
+      ++counter;
+    }
+  }
+
+  // aging: halve all counters after a sample period of 10 times the width
+  if (++m_nSamples >= 10 * m_width) {
+    for (auto& counter : m_counters) {
+      counter >>= 1;
+    }
+    m_nSamples /= 2;
+  }
+}
+
+uint8_t
+InMemoryStorageTinyLfu::FrequencySketch::estimate(size_t key) const noexcept
+{
+  uint8_t est = MAX_COUNT;
+  for (size_t row = 0; row < DEPTH; ++row) {
+    est = std::min(est, m_counters[getIndex(key, row)]);
+  }
+  return est;
+}
+
+InMemoryStorageTinyLfu::InMemoryStorageTinyLfu(size_t limit)
+  : InMemoryStorage(limit)
+{
+}
+
+InMemoryStorageTinyLfu::InMemoryStorageTinyLfu(boost::asio::io_context& ioCtx, size_t limit)
+  : InMemoryStorage(ioCtx, limit)
+{
+}
+
+void
+InMemoryStorageTinyLfu::afterInsert(InMemoryStorageEntry* entry)
+{
+  BOOST_ASSERT(m_window.size() + m_probation.size() + m_protected.size() <= size());
+  if (size() > m_sketch.getWidth()) {
+    m_sketch.ensureWidth(2 * size());
+  }
+  m_sketch.increment(getNameHash(entry));
+  m_window.insert(entry);
+}
+
+bool
+InMemoryStorageTinyLfu::evictItem()
+{
+  size_t windowTarget = std::max<size_t>(1, size() * WINDOW_PERCENT / 100);
+
+  // when the main area is empty, the window has taken up the whole cache;
+  // move its excess into the main area without competition, except for one candidate
+  if (m_probation.empty() && m_protected.empty()) {
+    auto& window = m_window.get<byUsedTime>();
+    while (m_window.size() > windowTarget + 1) {
+      m_probation.insert(window.front());
+      window.pop_front();
+    }
+  }
+
+  if (m_window.size() > windowTarget && m_probation.empty() && m_protected.empty()) {
+    evictFrom(m_window);
+    return true;
+  }
+
+  if (m_window.size() > windowTarget) {
+    InMemoryStorageEntry* candidate = m_window.get<byUsedTime>().front();
+    auto& main = m_probation.empty() ? m_protected : m_probation;
+    InMemoryStorageEntry* victim = main.get<byUsedTime>().front();
+
+    // admit the candidate only if it is more popular than the victim
+    if (m_sketch.estimate(getNameHash(candidate)) > m_sketch.estimate(getNameHash(victim))) {
+      m_window.get<byUsedTime>().pop_front();
+      m_probation.insert(candidate);
+      evictFrom(main);
+    }
+    else {
+      evictFrom(m_window);
+    }
+    return true;
+  }
+
+  if (!m_probation.empty()) {
+    evictFrom(m_probation);
+    return true;
+  }
+  if (!m_protected.empty()) {
+    evictFrom(m_protected);
+    return true;
+  }
+  if (!m_window.empty()) {
+    evictFrom(m_window);
+    return true;
+  }
+  return false;
+}
+
+void
+InMemoryStorageTinyLfu::evictFrom(CleanupIndex& list)
+{
+  auto& lru = list.get<byUsedTime>();
+  InMemoryStorageEntry* entry = lru.front();
+  lru.pop_front();
+  eraseImpl(entry->getFullName());
+}
+
+void
+InMemoryStorageTinyLfu::limitProtected()
+{
+  size_t protectedTarget = (m_probation.size() + m_protected.size()) * PROTECTED_PERCENT / 100;
+  auto& lru = m_protected.get<byUsedTime>();
+  while (m_protected.size() > std::max<size_t>(1, protectedTarget)) {
+    // demote to the most recently used end of the probation list
+    m_probation.insert(lru.front());
+    lru.pop_front();
+  }
+}
+
+void
+InMemoryStorageTinyLfu::beforeErase(InMemoryStorageEntry* entry)
+{
+  if (m_window.get<byEntity>().erase(entry) == 0 &&
+      m_probation.get<byEntity>().erase(entry) == 0) {
+    m_protected.get<byEntity>().erase(entry);
+  }
+}
+
+void
+InMemoryStorageTinyLfu::afterAccess(InMemoryStorageEntry* entry)
+{
+  m_sketch.increment(getNameHash(entry));
+
+  if (m_window.get<byEntity>().erase(entry) > 0) {
+    m_window.insert(entry);
+  }
+  else if (m_probation.get<byEntity>().erase(entry) > 0) {
+    // a hit in the probation list promotes the entry to the protected list
+    m_protected.insert(entry);
+    limitProtected();
+  }
+  else if (m_protected.get<byEntity>().erase(entry) > 0) {
+    m_protected.insert(entry);
+  }
+}
+
+} // namespace ndn
@@ -0,0 +1,163 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMS_IN_MEMORY_STORAGE_TINYLFU_HPP
+#define NDN_CXX_IMS_IN_MEMORY_STORAGE_TINYLFU_HPP
+
+#include "ndn-cxx/ims/in-memory-storage.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/identity.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+
+namespace ndn {
+
+/**
+ * @brief Provides in-memory storage employing Window TinyLFU (W-TinyLFU) replacement policy.
+ *
+ * Newly inserted packets enter a small LRU window. When a packet must be evicted, the least
+ * recently used packet of the window competes with the victim of the main area, which is
+ * managed by segmented LRU (probation and protected lists). The packet with the lower
+ * estimated access frequency is evicted. Access frequencies, including those of packets that
+ * are no longer in the cache, are estimated by a count-min sketch whose counters are halved
+ * periodically, so that the estimate favors recent popularity.
+ *
+ * Because InMemoryStorage does not report lookup misses to the replacement policy, the sketch
+ * counts insertions and hits. Packets are identified in the sketch by the hash of their name
+ * without implicit digest.
+ */
+class InMemoryStorageTinyLfu : public InMemoryStorage
+{
+public:
+  explicit
+  InMemoryStorageTinyLfu(size_t limit = 16);
+
+  explicit
+  InMemoryStorageTinyLfu(boost::asio::io_context& ioCtx, size_t limit = 16);
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PROTECTED:
+  /** @brief Removes one Data packet from in-memory storage, admitting the window candidate
+   *  into the main area only if it is estimated to be more popular than the main victim
+   *  @return{ whether the Data was removed }
+   */
+  bool
+  evictItem() override;
+
+  /** @brief Record the access in the sketch and update the position of the entry
+   */
+  void
+  afterAccess(InMemoryStorageEntry* entry) override;
+
+  /** @brief Record the insertion in the sketch and add the entry to the window
+   */
+  void
+  afterInsert(InMemoryStorageEntry* entry) override;
+
+  /** @brief Remove the entry from the window or the main area
+   */
+  void
+  beforeErase(InMemoryStorageEntry* entry) override;
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /**
+   * @brief Count-min sketch with 4-bit saturating counters and periodic aging.
+   */
+  class FrequencySketch
+  {
+  public:
+    explicit
+    FrequencySketch(size_t width = MIN_WIDTH);
+
+    void
+    increment(size_t key) noexcept;
+
+    uint8_t
+    estimate(size_t key) const noexcept;
+
+    size_t
+    getWidth() const noexcept
+    {
+      return m_width;
+    }
+
+    /**
+     * @brief Grow the sketch to at least @p width counters per row, keeping all estimates.
+     */
+    void
+    ensureWidth(size_t width);
+
+  private:
+    size_t
+    getIndex(size_t key, size_t row) const noexcept;
+
+  public:
+    static constexpr size_t MIN_WIDTH = 64;
+    static constexpr size_t DEPTH = 4;
+    static constexpr uint8_t MAX_COUNT = 15;
+
+  private:
+    std::vector<uint8_t> m_counters;
+    size_t m_width = 0;
+    size_t m_nSamples = 0;
+  };
+
+private:
+  // multi_index_container to implement LRU lists
+  class byUsedTime;
+  class byEntity;
+
+  using CleanupIndex = boost::multi_index_container<
+    InMemoryStorageEntry*,
+    boost::multi_index::indexed_by<
+      // by Entry itself
+      boost::multi_index::hashed_unique<
+        boost::multi_index::tag<byEntity>,
+        boost::multi_index::identity<InMemoryStorageEntry*>
+      >,
+      // by last used time (LRU)
+      boost::multi_index::sequenced<
+        boost::multi_index::tag<byUsedTime>
+      >
+    >
+  >;
+
+  void
+  evictFrom(CleanupIndex& list);
+
+  void
+  limitProtected();
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /// percentage of the cache used by the window
+  static constexpr size_t WINDOW_PERCENT = 1;
+  /// percentage of the main area used by the protected list
+  static constexpr size_t PROTECTED_PERCENT = 80;
+
+  CleanupIndex m_window;
+  CleanupIndex m_probation;
+  CleanupIndex m_protected;
+  FrequencySketch m_sketch;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_IMS_IN_MEMORY_STORAGE_TINYLFU_HPP
@@ -46,10 +46,10 @@ InMemoryStorage::InMemoryStorage(size_t limit)
   init();
 }
 
-InMemoryStorage::InMemoryStorage(boost::asio::io_context& ioCtx, size_t limit)
+InMemoryStorage::InMemoryStorage(boost::asio::io_context&, size_t limit)
   : m_limit(limit)
+  , m_isFreshnessTracked(true)
 {
-  m_scheduler = make_unique<Scheduler>(ioCtx);
   init();
 }
 
@@ -59,8 +59,9 @@ InMemoryStorage::init()
   // TODO: consider a more suitable initial value
   m_capacity = MIN_CAPACITY;
 
-  if (m_limit != std::numeric_limits<size_t>::max() && m_capacity > m_limit) {
-    m_capacity = m_limit;
+  size_t limit = getLimit();
+  if (limit != std::numeric_limits<size_t>::max() && m_capacity > limit) {
+    m_capacity = limit;
   }
 
   for (size_t i = 0; i < m_capacity; i++) {
@@ -114,13 +115,38 @@ InMemoryStorage::setCapacity(size_t capacity)
   BOOST_ASSERT(size() + m_freeEntries.size() == m_capacity);
 }
 
+void
+InMemoryStorage::setByteLimit(size_t nBytes)
+{
+  while (m_nBytes > nBytes) {
+    if (!evictItem()) {
+      NDN_THROW(Error("Cannot reduce the byte limit of the in-memory storage to " +
+                      to_string(nBytes) + " octets"));
+    }
+  }
+  m_byteLimit = nBytes;
+}
+
 void
 InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow)
 {
   // check if identical Data/Name already exists
-  auto it = m_cache.get<byFullName>().find(data.getFullName());
-  if (it != m_cache.get<byFullName>().end())
+  auto it = m_cache.get<byExactFullName>().find(data.getFullName());
+  if (it != m_cache.get<byExactFullName>().end())
+    return;
+
+  // if over the byte limit, employ replacement policy until the new packet fits
+  size_t entrySize = InMemoryStorageEntry::computeSize(data);
+  if (entrySize > m_byteLimit) {
+    ++m_counters.nRejectedInserts;
     return;
+  }
+  while (m_nBytes + entrySize > m_byteLimit) {
+    if (!evictItem()) {
+      ++m_counters.nRejectedInserts;
+      return;
+    }
+  }
 
   // if full, double the capacity
   bool doesReachLimit = (getLimit() == getCapacity());
@@ -140,10 +166,11 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
   // take entry for the memory pool
   InMemoryStorageEntry* entry = m_freeEntries.top();
   m_freeEntries.pop();
-  m_nPackets++;
+  m_nPackets.fetch_add(1, std::memory_order_relaxed);
   entry->setData(data);
-  if (m_scheduler != nullptr && mustBeFreshProcessingWindow >= ZERO_WINDOW) {
-    entry->scheduleMarkStale(*m_scheduler, mustBeFreshProcessingWindow);
+  m_nBytes += entry->getSize();
+  if (m_isFreshnessTracked && mustBeFreshProcessingWindow >= ZERO_WINDOW) {
+    entry->setStaleTime(time::steady_clock::now() + mustBeFreshProcessingWindow);
   }
   m_cache.insert(entry);
 
@@ -154,36 +181,95 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
 shared_ptr<const Data>
 InMemoryStorage::find(const Name& name)
 {
-  auto it = m_cache.get<byFullName>().lower_bound(name);
-
-  // if not found, return null
-  if (it == m_cache.get<byFullName>().end()) {
-    return nullptr;
-  }
-
-  // if the given name is not the prefix of the lower_bound, return null
-  if (!name.isPrefixOf((*it)->getFullName())) {
+  InMemoryStorageEntry* entry = findEntry(name);
+  if (entry == nullptr) {
+    countMiss();
     return nullptr;
   }
 
-  afterAccess(*it);
-  return ((*it)->getData()).shared_from_this();
+  countHit(entry);
+  return entry->getData().shared_from_this();
 }
 
 shared_ptr<const Data>
 InMemoryStorage::find(const Interest& interest)
 {
   // if the interest contains implicit digest, it is possible to directly locate a packet.
-  auto it = m_cache.get<byFullName>().find(interest.getName());
+  auto it = m_cache.get<byExactFullName>().find(interest.getName());
 
   // if a packet is located by its full name, it must be the packet to return.
-  if (it != m_cache.get<byFullName>().end()) {
+  if (it != m_cache.get<byExactFullName>().end()) {
+    ++m_counters.nHits;
     return ((*it)->getData()).shared_from_this();
   }
 
-  // if the packet is not discovered by last step, either the packet is not in the storage or
-  // the interest doesn't contains implicit digest.
-  it = m_cache.get<byFullName>().lower_bound(interest.getName());
+  InMemoryStorageEntry* ret = findEntry(interest);
+  if (ret == nullptr) {
+    countMiss(interest.getMustBeFresh() && m_isFreshnessTracked &&
+              findEntry(interest, true) != nullptr);
+    return nullptr;
+  }
+
+  countHit(ret);
+  return ret->getData().shared_from_this();
+}
+
+InMemoryStorageEntry*
+InMemoryStorage::findEntry(const Name& name) const
+{
+  // try exact matches on the full name and on the name without implicit digest first
+  auto fullNameIt = m_cache.get<byExactFullName>().find(name);
+  if (fullNameIt != m_cache.get<byExactFullName>().end()) {
+    return *fullNameIt;
+  }
+  // among packets with the same name, the result must not depend on the order of the hashed index
+  InMemoryStorageEntry* best = nullptr;
+  auto [first, last] = m_cache.get<byExactName>().equal_range(name);
+  for (auto it = first; it != last; ++it) {
+    if (best == nullptr || (*it)->getFullName() < best->getFullName()) {
+      best = *it;
+    }
+  }
+  if (best != nullptr) {
+    return best;
+  }
+
+  auto it = m_cache.get<byFullName>().lower_bound(name);
+  // if not found, or if the given name is not the prefix of the lower_bound, return null
+  if (it == m_cache.get<byFullName>().end() || !name.isPrefixOf((*it)->getFullName())) {
+    return nullptr;
+  }
+  return *it;
+}
+
+void
+InMemoryStorage::countHit(InMemoryStorageEntry* entry)
+{
+  ++m_counters.nHits;
+  // let derived class do something with the entry
+  afterAccess(entry);
+}
+
+void
+InMemoryStorage::countMiss(bool isStaleHit)
+{
+  ++m_counters.nMisses;
+  if (isStaleHit) {
+    ++m_counters.nStaleHits;
+  }
+}
+
+InMemoryStorageEntry*
+InMemoryStorage::findEntry(const Interest& interest, bool ignoreFreshness) const
+{
+  if (!interest.getCanBePrefix()) {
+    // without CanBePrefix, only Data with exactly the Interest name can match
+    return findExact(interest, ignoreFreshness);
+  }
+
+  // if the packet is not discovered by the full name, either the packet is not in the storage
+  // or the interest doesn't contains implicit digest.
+  auto it = m_cache.get<byFullName>().lower_bound(interest.getName());
 
   if (it == m_cache.get<byFullName>().end()) {
     return nullptr;
@@ -194,14 +280,26 @@ InMemoryStorage::find(const Interest& interest)
     it--;
   }
 
-  InMemoryStorageEntry* ret = selectChild(interest, it);
-  if (ret == nullptr) {
-    return nullptr;
-  }
+  return selectChild(interest, it, ignoreFreshness);
+}
 
-  // let derived class do something with the entry
-  afterAccess(ret);
-  return ret->getData().shared_from_this();
+InMemoryStorageEntry*
+InMemoryStorage::findExact(const Interest& interest, bool ignoreFreshness) const
+{
+  bool mustBeFresh = interest.getMustBeFresh() && !ignoreFreshness;
+  // as with a search in canonical order, the match with the smallest full name is returned
+  InMemoryStorageEntry* best = nullptr;
+  auto [first, last] = m_cache.get<byExactName>().equal_range(interest.getName());
+  for (auto it = first; it != last; ++it) {
+    if (mustBeFresh && !(*it)->isFresh()) {
+      continue;
+    }
+    if ((best == nullptr || (*it)->getFullName() < best->getFullName()) &&
+        interest.matchesData((*it)->getData())) {
+      best = *it;
+    }
+  }
+  return best;
 }
 
 InMemoryStorage::Cache::index<InMemoryStorage::byFullName>::type::iterator
@@ -217,8 +315,11 @@ InMemoryStorage::findNextFresh(Cache::index<byFullName>::type::iterator it) cons
 
 InMemoryStorageEntry*
 InMemoryStorage::selectChild(const Interest& interest,
-                             Cache::index<byFullName>::type::iterator startingPoint) const
+                             Cache::index<byFullName>::type::iterator startingPoint,
+                             bool ignoreFreshness) const
 {
+  bool mustBeFresh = interest.getMustBeFresh() && !ignoreFreshness;
+
   BOOST_ASSERT(startingPoint != m_cache.get<byFullName>().end());
 
   if (startingPoint != m_cache.get<byFullName>().begin()) {
@@ -226,7 +327,7 @@ InMemoryStorage::selectChild(const Interest& interest,
   }
 
   // filter out non-fresh data
-  if (interest.getMustBeFresh()) {
+  if (mustBeFresh) {
     startingPoint = findNextFresh(startingPoint);
   }
 
@@ -243,7 +344,7 @@ InMemoryStorage::selectChild(const Interest& interest,
   while (true) {
     ++rightmostCandidate;
     // filter out non-fresh data
-    if (interest.getMustBeFresh()) {
+    if (mustBeFresh) {
       rightmostCandidate = findNextFresh(rightmostCandidate);
     }
 
@@ -268,9 +369,10 @@ InMemoryStorage::Cache::iterator
 InMemoryStorage::freeEntry(Cache::iterator it)
 {
   // push the *empty* entry into mem pool
+  m_nBytes -= (*it)->getSize();
   (*it)->release();
   m_freeEntries.push(*it);
-  m_nPackets--;
+  m_nPackets.fetch_sub(1, std::memory_order_relaxed);
   return m_cache.erase(it);
 }
 
@@ -286,13 +388,13 @@ InMemoryStorage::erase(const Name& prefix, const bool isPrefix)
     }
   }
   else {
-    auto it = m_cache.get<byFullName>().find(prefix);
-    if (it == m_cache.get<byFullName>().end())
+    auto it = m_cache.get<byExactFullName>().find(prefix);
+    if (it == m_cache.get<byExactFullName>().end())
       return;
 
     // let derived class do something with the entry
     beforeErase(*it);
-    freeEntry(it);
+    freeEntry(m_cache.project<byFullName>(it));
   }
 
   if (m_freeEntries.size() > (2 * size()))
@@ -302,11 +404,13 @@ InMemoryStorage::erase(const Name& prefix, const bool isPrefix)
 void
 InMemoryStorage::eraseImpl(const Name& name)
 {
-  auto it = m_cache.get<byFullName>().find(name);
-  if (it == m_cache.get<byFullName>().end())
+  auto it = m_cache.get<byExactFullName>().find(name);
+  if (it == m_cache.get<byExactFullName>().end())
     return;
 
-  freeEntry(it);
+  ++m_counters.nEvictions;
+  beforeEvict((*it)->getData());
+  freeEntry(m_cache.project<byFullName>(it));
 }
 
 InMemoryStorage::const_iterator
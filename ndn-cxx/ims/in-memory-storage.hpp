@@ -22,12 +22,17 @@
 #ifndef NDN_CXX_IMS_IN_MEMORY_STORAGE_HPP
 #define NDN_CXX_IMS_IN_MEMORY_STORAGE_HPP
 
+#include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/ims/in-memory-storage-entry.hpp"
+#include "ndn-cxx/util/counters.hpp"
+#include "ndn-cxx/util/signal.hpp"
 
+#include <atomic>
 #include <limits>
 #include <stack>
 
 #include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/member.hpp>
@@ -36,6 +41,20 @@
 
 namespace ndn {
 
+/** @brief Lookup and replacement counters of an InMemoryStorage.
+ *
+ *  The counters are updated by the thread using the InMemoryStorage and can be read from any thread.
+ */
+struct InMemoryStorageCounters : noncopyable
+{
+  util::Counter nHits;   ///< lookups that returned a packet
+  util::Counter nMisses; ///< lookups that returned no packet
+  /// lookups with MustBeFresh, counted in nMisses, that only matched stale packets
+  util::Counter nStaleHits;
+  util::Counter nEvictions;       ///< packets evicted by the replacement policy
+  util::Counter nRejectedInserts; ///< packets not inserted because they exceed the byte limit
+};
+
 /** @brief Represents in-memory storage.
  */
 class InMemoryStorage : noncopyable
@@ -43,16 +62,32 @@ class InMemoryStorage : noncopyable
 public:
   // multi_index_container to implement storage
   class byFullName;
+  class byExactFullName;
+  class byExactName;
 
   using Cache = boost::multi_index_container<
     InMemoryStorageEntry*,
     boost::multi_index::indexed_by<
-      // by Full Name
+      // by Full Name, for prefix lookups and iteration in canonical order
       boost::multi_index::ordered_unique<
         boost::multi_index::tag<byFullName>,
         boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
                                           &InMemoryStorageEntry::getFullName>,
         std::less<Name>
+      >,
+      // by Full Name, for exact lookups
+      boost::multi_index::hashed_unique<
+        boost::multi_index::tag<byExactFullName>,
+        boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
+                                          &InMemoryStorageEntry::getFullName>,
+        std::hash<Name>
+      >,
+      // by Name without implicit digest, for exact lookups
+      boost::multi_index::hashed_non_unique<
+        boost::multi_index::tag<byExactName>,
+        boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
+                                          &InMemoryStorageEntry::getName>,
+        std::hash<Name>
       >
     >
   >;
@@ -103,6 +138,12 @@ public:
       : std::runtime_error("Cannot reduce the capacity of the in-memory storage!")
     {
     }
+
+    explicit
+    Error(const std::string& what)
+      : std::runtime_error(what)
+    {
+    }
   };
 
   /** @brief Create a InMemoryStorage with up to @p limit entries.
@@ -115,6 +156,8 @@ public:
   /** @brief Create a InMemoryStorage with up to @p limit entries.
    *
    *  The InMemoryStorage created through this method will handle MustBeFresh in interest processing
+   *
+   *  @note Freshness is evaluated lazily upon lookup, so @p ioCtx is not used to run any timers.
    */
   explicit
   InMemoryStorage(boost::asio::io_context& ioCtx,
@@ -127,6 +170,8 @@ public:
   ~InMemoryStorage();
 
   /** @brief Inserts a Data packet.
+   *
+   *  The packet is not inserted if it does not fit in the byte limit, see setByteLimit().
    *
    *  @param data the packet to insert, must be signed and have wire encoding
    *  @param mustBeFreshProcessingWindow Beyond this time period, the inserted data can
@@ -135,6 +180,7 @@ public:
    *         correspond to FreshnessPeriod.
    *
    *  @note InMemoryStorage does not use the inserted data packet's FreshnessPeriod value.
+   *        No timer is scheduled; the entry is checked against its stale time upon lookup.
    *        If the packet needs to be marked "stale" after application-defined period of time,
    *        the application must supply proper @p mustBeFreshProcessingWindow value.
    *
@@ -148,6 +194,10 @@ public:
   insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow = INFINITE_WINDOW);
 
   /** @brief Finds the best match Data for an Interest.
+   *
+   *  Interests without CanBePrefix, as well as Interests whose name includes the implicit
+   *  digest, are answered in constant time. Only Interests with CanBePrefix need a search
+   *  in canonical order.
    *
    *  @note It will invoke afterAccess(shared_ptr<InMemoryStorageEntry>).
    *  As currently it is impossible to determine whether a Name contains implicit digest or not,
@@ -163,8 +213,8 @@ public:
   /** @brief Finds the best match Data for a Name with or without implicit digest.
    *
    *  If packets with the same name but different digests exist
-   *  and the Name supplied is the one without implicit digest, a packet
-   *  will be arbitrarily chosen to return.
+   *  and the Name supplied is the one without implicit digest, the packet
+   *  whose full name comes first in canonical order is returned.
    *
    *  @note It will invoke afterAccess(shared_ptr<InMemoryStorageEntry>).
    *
@@ -192,7 +242,7 @@ public:
   size_t
   getLimit() const
   {
-    return m_limit;
+    return m_limit.load(std::memory_order_relaxed);
   }
 
   /** @return Number of packets stored in in-memory storage.
@@ -200,7 +250,54 @@ public:
   size_t
   size() const
   {
-    return m_nPackets;
+    return m_nPackets.load(std::memory_order_relaxed);
+  }
+
+  /** @return Whether MustBeFresh is handled in interest processing, i.e., whether this
+   *          in-memory storage has been created with an io_context.
+   */
+  bool
+  isFreshnessTracked() const
+  {
+    return m_isFreshnessTracked;
+  }
+
+  /** @brief Returns the lookup and replacement counters.
+   */
+  const InMemoryStorageCounters&
+  getCounters() const noexcept
+  {
+    return m_counters;
+  }
+
+  /** @return Maximum number of octets that can be used by packets in in-memory storage.
+   */
+  size_t
+  getByteLimit() const
+  {
+    return m_byteLimit;
+  }
+
+  /** @brief Limits the memory used by packets in in-memory storage.
+   *
+   *  The memory used by each packet is estimated with InMemoryStorageEntry::getSize().
+   *  If the current usage exceeds @p nBytes, packets are evicted according to the replacement
+   *  policy until the usage is within the limit. When a packet is inserted and the limit would
+   *  be exceeded, packets are evicted in the same way; if not enough packets can be evicted,
+   *  the new packet is not inserted.
+   *
+   *  @throw Error not enough packets can be evicted to meet the new limit; the limit is then
+   *               left unchanged, but the packets evicted so far are not restored
+   */
+  void
+  setByteLimit(size_t nBytes);
+
+  /** @return Number of octets used by packets stored in in-memory storage.
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_nBytes;
   }
 
   /** @brief Returns begin iterator of the in-memory storage ordering by name with digest.
@@ -275,7 +372,7 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PROTECTED:
    *
    *  This is the function one should use to erase entry in the cache
    *  in derived class.
-   *  It won't invoke beforeErase(shared_ptr<Entry>).
+   *  It won't invoke beforeErase(shared_ptr<Entry>), but it emits beforeEvict.
    */
   void
   eraseImpl(const Name& name);
@@ -292,6 +389,38 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   Cache::iterator
   freeEntry(Cache::iterator it);
 
+  /** @brief Finds the best match for @p interest without updating the replacement policy.
+   *  @param ignoreFreshness if true, the MustBeFresh element of @p interest is disregarded
+   *  @return the match, if any; otherwise nullptr
+   */
+  InMemoryStorageEntry*
+  findEntry(const Interest& interest, bool ignoreFreshness = false) const;
+
+  /** @brief Finds the best match for @p name without updating the counters or the
+   *         replacement policy.
+   *  @return the match, if any; otherwise nullptr
+   *  @sa find(const Name&)
+   */
+  InMemoryStorageEntry*
+  findEntry(const Name& name) const;
+
+  /** @brief Counts a lookup that returned @p entry and notifies the replacement policy.
+   */
+  void
+  countHit(InMemoryStorageEntry* entry);
+
+  /** @brief Counts a lookup that returned no packet.
+   *  @param isStaleHit whether the lookup would have matched a stale packet without MustBeFresh
+   */
+  void
+  countMiss(bool isStaleHit = false);
+
+  /** @brief Finds the entry with exactly the given name that satisfies @p interest.
+   *  @return the match with the smallest full name, if any; otherwise nullptr
+   */
+  InMemoryStorageEntry*
+  findExact(const Interest& interest, bool ignoreFreshness = false) const;
+
   /** @brief Implements child selector (leftmost, rightmost, undeclared).
    *
    *  Operates on the first layer of a skip list.
@@ -310,7 +439,8 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
    */
   InMemoryStorageEntry*
   selectChild(const Interest& interest,
-              Cache::index<byFullName>::type::iterator startingPoint) const;
+              Cache::index<byFullName>::type::iterator startingPoint,
+              bool ignoreFreshness = false) const;
 
   /** @brief Get the next iterator (include startingPoint) that satisfies MustBeFresh requirement.
    *
@@ -327,18 +457,34 @@ private:
 public:
   static constexpr time::milliseconds INFINITE_WINDOW = -1_ms;
 
+  /** @brief Emitted when a Data packet is about to be evicted by the replacement policy.
+   *
+   *  The signal is not emitted when packets are removed through erase() or when the storage
+   *  is destroyed. The handler must not modify the storage.
+   */
+  signal::Signal<InMemoryStorage, Data> beforeEvict;
+
 private:
   Cache m_cache;
-  /// user defined maximum capacity of the in-memory storage in packets
-  size_t m_limit = 0;
+  /// user defined maximum capacity of the in-memory storage in packets; read by getLimit()
+  /// from any thread
+  std::atomic<size_t> m_limit = 0;
   /// current capacity of the in-memory storage in packets
   size_t m_capacity = 0;
-  /// current number of packets in in-memory storage
-  size_t m_nPackets = 0;
+  /// current number of packets in in-memory storage; read by size() from any thread
+  std::atomic<size_t> m_nPackets = 0;
+  /// user defined maximum number of octets used by packets in in-memory storage
+  size_t m_byteLimit = std::numeric_limits<size_t>::max();
+  /// current number of octets used by packets in in-memory storage
+  size_t m_nBytes = 0;
   /// memory pool
   std::stack<InMemoryStorageEntry*> m_freeEntries;
-  /// scheduler
-  unique_ptr<Scheduler> m_scheduler;
+  /// whether MustBeFresh is handled
+  bool m_isFreshnessTracked = false;
+  InMemoryStorageCounters m_counters;
+
+  // probes shards with findEntry() and counts only the lookup result that it returns
+  friend class InMemoryStorageSharded;
 };
 
 } // namespace ndn
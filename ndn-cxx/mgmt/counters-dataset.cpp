@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/mgmt/counters-dataset.hpp"
+#include "ndn-cxx/version.hpp"
+
+namespace ndn::mgmt {
+
+nfd::ForwarderStatus
+makeFaceCountersSnapshot(const Face& face, time::system_clock::time_point startTime)
+{
+  const auto& counters = face.getCounters();
+
+  nfd::ForwarderStatus status;
+  status.setNfdVersion(NDN_CXX_VERSION_BUILD_STRING)
+        .setStartTimestamp(startTime)
+        .setCurrentTimestamp(time::system_clock::now())
+        .setNPitEntries(face.getNPendingInterests())
+        .setNInInterests(counters.nInInterests)
+        .setNInData(counters.nInData)
+        .setNInNacks(counters.nInNacks)
+        .setNOutInterests(counters.nOutInterests)
+        .setNOutData(counters.nOutData)
+        .setNOutNacks(counters.nOutNacks)
+        .setNSatisfiedInterests(counters.nSatisfiedInterests)
+        .setNUnsatisfiedInterests(counters.nNackedInterests + counters.nTimedOutInterests);
+  return status;
+}
+
+void
+addFaceCountersDataset(Dispatcher& dispatcher, const PartialName& relPrefix, const Face& face,
+                       Authorization authorize)
+{
+  dispatcher.addStatusDataset(relPrefix, std::move(authorize),
+    [&face, startTime = time::system_clock::now()] (const Name&, const Interest&,
+                                                    StatusDatasetContext& context) {
+      context.append(makeFaceCountersSnapshot(face, startTime).wireEncode());
+      context.end();
+    });
+}
+
+nfd::CsInfo
+makeImsCountersSnapshot(const InMemoryStorage& ims)
+{
+  const auto& counters = ims.getCounters();
+
+  nfd::CsInfo info;
+  info.setCapacity(ims.getLimit())
+      .setEnableAdmit(true)
+      .setEnableServe(true)
+      .setNEntries(ims.size())
+      .setNHits(counters.nHits)
+      .setNMisses(counters.nMisses);
+  return info;
+}
+
+void
+addImsCountersDataset(Dispatcher& dispatcher, const PartialName& relPrefix,
+                      const InMemoryStorage& ims, Authorization authorize)
+{
+  dispatcher.addStatusDataset(relPrefix, std::move(authorize),
+    [&ims] (const Name&, const Interest&, StatusDatasetContext& context) {
+      context.append(makeImsCountersSnapshot(ims).wireEncode());
+      context.end();
+    });
+}
+
+} // namespace ndn::mgmt
@@ -0,0 +1,99 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_MGMT_COUNTERS_DATASET_HPP
+#define NDN_CXX_MGMT_COUNTERS_DATASET_HPP
+
+#include "ndn-cxx/face.hpp"
+#include "ndn-cxx/ims/in-memory-storage.hpp"
+#include "ndn-cxx/mgmt/dispatcher.hpp"
+#include "ndn-cxx/mgmt/nfd/cs-info.hpp"
+#include "ndn-cxx/mgmt/nfd/forwarder-status.hpp"
+
+namespace ndn::mgmt {
+
+/**
+ * \brief Take a snapshot of the counters of \p face.
+ *
+ * The snapshot is expressed as an NFD General Status dataset block:
+ *  - NfdVersion is the ndn-cxx version string;
+ *  - StartTimestamp is \p startTime, CurrentTimestamp is the current system time;
+ *  - NPitEntries is the number of pending Interests;
+ *  - the packet counters are copied from Face::getCounters();
+ *  - NSatisfiedInterests counts Interests satisfied by Data, NUnsatisfiedInterests counts
+ *    Interests that were Nacked or timed out;
+ *  - all other fields are zero.
+ *
+ * \note This function can be called from any thread.
+ */
+nfd::ForwarderStatus
+makeFaceCountersSnapshot(const Face& face, time::system_clock::time_point startTime);
+
+/**
+ * \brief Publish the counters of \p face as a status dataset.
+ * \param dispatcher the Dispatcher on which the dataset is registered
+ * \param relPrefix dataset prefix relative to the top-level prefix, e.g., "status/face"
+ * \param face the Face whose counters are published; it must outlive \p dispatcher
+ * \param authorize authorization callback for dataset requests
+ * \sa makeFaceCountersSnapshot()
+ *
+ * Each dataset response contains a single nfd::ForwarderStatus block.
+ */
+void
+addFaceCountersDataset(Dispatcher& dispatcher, const PartialName& relPrefix, const Face& face,
+                       Authorization authorize = makeAcceptAllAuthorization());
+
+/**
+ * \brief Take a snapshot of the counters of \p ims.
+ *
+ * The snapshot is expressed as an NFD CS Information dataset block:
+ *  - Capacity is InMemoryStorage::getLimit(), NEntries is InMemoryStorage::size();
+ *  - EnableAdmit and EnableServe are true;
+ *  - NHits and NMisses are copied from InMemoryStorage::getCounters().
+ *
+ * The other counters of InMemoryStorageCounters have no equivalent in the CS Information
+ * dataset and are not included.
+ *
+ * \note This function can be called from any thread, provided that \p ims is not being
+ *       destroyed. Every field is read atomically, but the fields are not read together, so
+ *       NEntries may not match NHits and NMisses if \p ims is modified concurrently.
+ */
+nfd::CsInfo
+makeImsCountersSnapshot(const InMemoryStorage& ims);
+
+/**
+ * \brief Publish the counters of \p ims as a status dataset.
+ * \param dispatcher the Dispatcher on which the dataset is registered
+ * \param relPrefix dataset prefix relative to the top-level prefix, e.g., "status/cache"
+ * \param ims the InMemoryStorage whose counters are published; it must outlive \p dispatcher
+ * \param authorize authorization callback for dataset requests
+ * \sa makeImsCountersSnapshot()
+ *
+ * Each dataset response contains a single nfd::CsInfo block.
+ */
+void
+addImsCountersDataset(Dispatcher& dispatcher, const PartialName& relPrefix,
+                      const InMemoryStorage& ims,
+                      Authorization authorize = makeAcceptAllAuthorization());
+
+} // namespace ndn::mgmt
+
+#endif // NDN_CXX_MGMT_COUNTERS_DATASET_HPP
@@ -44,16 +44,63 @@ CertificateFetcherFromNetwork::doFetch(const shared_ptr<CertificateRequest>& cer
                                        const shared_ptr<ValidationState>& state,
                                        const ValidationContinuation& continueValidation)
 {
+  auto& pending = m_pendingFetches[certRequest->interest.getName()];
+  pending.push_back({state, continueValidation});
+  if (pending.size() > 1) {
+    NDN_LOG_DEBUG_DEPTH("Waiting for pending retrieval of " << certRequest->interest.getName());
+    return;
+  }
+
   m_face.expressInterest(certRequest->interest,
-                         [=] (const Interest&, const Data& data) {
-                           dataCallback(data, certRequest, state, continueValidation);
-                         },
-                         [=] (const Interest&, const lp::Nack& nack) {
-                           nackCallback(nack, certRequest, state, continueValidation);
-                         },
-                         [=] (const Interest&) {
-                           timeoutCallback(certRequest, state, continueValidation);
-                         });
+    [=] (const Interest&, const Data& data) {
+      for (const auto& v : takePendingValidations(*certRequest, state, continueValidation)) {
+        dataCallback(data, certRequest, v.state, v.continueValidation);
+      }
+    },
+    [=] (const Interest&, const lp::Nack& nack) {
+      nackCallback(nack, certRequest, state, continueValidation);
+    },
+    [=] (const Interest&) {
+      timeoutCallback(certRequest, state, continueValidation);
+    });
+}
+
+std::vector<CertificateFetcherFromNetwork::PendingValidation>
+CertificateFetcherFromNetwork::takePendingValidations(const CertificateRequest& certRequest,
+                                                      const shared_ptr<ValidationState>& state,
+                                                      const ValidationContinuation& continueValidation)
+{
+  auto it = m_pendingFetches.find(certRequest.interest.getName());
+  if (it == m_pendingFetches.end()) {
+    // the Interest was not expressed by doFetch, e.g., a direct Interest of a subclass
+    return {{state, continueValidation}};
+  }
+  auto pending = std::move(it->second);
+  m_pendingFetches.erase(it);
+  return pending;
+}
+
+void
+CertificateFetcherFromNetwork::retryFetch(const shared_ptr<CertificateRequest>& certRequest,
+                                          const shared_ptr<ValidationState>& state,
+                                          const ValidationContinuation& continueValidation)
+{
+  // the first validation expresses the Interest again, and the others join it
+  for (const auto& v : takePendingValidations(*certRequest, state, continueValidation)) {
+    fetch(certRequest, v.state, v.continueValidation);
+  }
+}
+
+void
+CertificateFetcherFromNetwork::failFetch(const shared_ptr<CertificateRequest>& certRequest,
+                                         const shared_ptr<ValidationState>& state,
+                                         const ValidationContinuation& continueValidation,
+                                         const std::string& reason)
+{
+  for (const auto& v : takePendingValidations(*certRequest, state, continueValidation)) {
+    v.state->fail({ValidationError::CANNOT_RETRIEVE_CERT, reason + " after exhausting all retries "
+                   "for `" + certRequest->interest.getName().toUri() + "`"});
+  }
 }
 
 void
@@ -86,12 +133,11 @@ CertificateFetcherFromNetwork::nackCallback(const lp::Nack& nack,
   --certRequest->nRetriesLeft;
   if (certRequest->nRetriesLeft >= 0) {
     m_scheduler.schedule(certRequest->waitAfterNack,
-                         [=] { fetch(certRequest, state, continueValidation); });
+                         [=] { retryFetch(certRequest, state, continueValidation); });
     certRequest->waitAfterNack *= 2;
   }
   else {
-    state->fail({ValidationError::CANNOT_RETRIEVE_CERT, "Nack after exhausting all retries for "
-                 "`" + certRequest->interest.getName().toUri() + "`"});
+    failFetch(certRequest, state, continueValidation, "Nack");
   }
 }
 
@@ -104,11 +150,10 @@ CertificateFetcherFromNetwork::timeoutCallback(const shared_ptr<CertificateReque
 
   --certRequest->nRetriesLeft;
   if (certRequest->nRetriesLeft >= 0) {
-    fetch(certRequest, state, continueValidation);
+    retryFetch(certRequest, state, continueValidation);
   }
   else {
-    state->fail({ValidationError::CANNOT_RETRIEVE_CERT, "Timeout after exhausting all retries for "
-                 "`" + certRequest->interest.getName().toUri() + "`"});
+    failFetch(certRequest, state, continueValidation, "Timeout");
   }
 }
 
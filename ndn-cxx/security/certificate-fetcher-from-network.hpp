@@ -22,9 +22,12 @@
 #ifndef NDN_CXX_SECURITY_CERTIFICATE_FETCHER_FROM_NETWORK_HPP
 #define NDN_CXX_SECURITY_CERTIFICATE_FETCHER_FROM_NETWORK_HPP
 
+#include "ndn-cxx/name.hpp"
 #include "ndn-cxx/security/certificate-fetcher.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
 
+#include <map>
+
 namespace ndn {
 
 class Data;
@@ -38,6 +41,10 @@ namespace security {
 
 /**
  * @brief Fetch missing keys from the network
+ *
+ * Concurrent requests for the same certificate name are coalesced: only the first one expresses
+ * an Interest, and all validations waiting for the certificate resume when it is retrieved, or
+ * fail together when the retrieval fails.
  */
 class CertificateFetcherFromNetwork : public CertificateFetcher
 {
@@ -77,9 +84,43 @@ protected:
   timeoutCallback(const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state,
                   const ValidationContinuation& continueValidation);
 
+private:
+  struct PendingValidation
+  {
+    shared_ptr<ValidationState> state;
+    ValidationContinuation continueValidation;
+  };
+
+  /**
+   * @brief Remove and return the validations waiting for the certificate requested by @p certRequest.
+   *
+   * If the request is not in the table of pending fetches, only @p state is waiting for it.
+   */
+  std::vector<PendingValidation>
+  takePendingValidations(const CertificateRequest& certRequest, const shared_ptr<ValidationState>& state,
+                         const ValidationContinuation& continueValidation);
+
+  /**
+   * @brief Request the certificate again on behalf of all validations waiting for it.
+   */
+  void
+  retryFetch(const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state,
+             const ValidationContinuation& continueValidation);
+
+  /**
+   * @brief Fail all validations waiting for the certificate requested by @p certRequest.
+   */
+  void
+  failFetch(const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state,
+            const ValidationContinuation& continueValidation, const std::string& reason);
+
 protected:
   Face& m_face;
   Scheduler m_scheduler;
+
+private:
+  /// validations waiting for a certificate being retrieved, keyed by the name in the request
+  std::map<Name, std::vector<PendingValidation>> m_pendingFetches;
 };
 
 } // namespace security
@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/validation-result-cache.hpp"
+
+namespace ndn::security {
+
+ValidationResultCache::ValidationResultCache(size_t capacity, time::nanoseconds lifetime)
+  : m_capacity(capacity)
+  , m_lifetime(lifetime)
+{
+  if (m_capacity == 0) {
+    NDN_THROW(std::invalid_argument("ValidationResultCache capacity must be positive"));
+  }
+}
+
+void
+ValidationResultCache::insert(const Name& fullName)
+{
+  refresh();
+
+  auto& byName = m_entries.get<1>();
+  auto it = byName.find(fullName);
+  if (it != byName.end()) {
+    // restart the lifetime of the entry
+    m_entries.relocate(m_entries.end(), m_entries.project<0>(it));
+    byName.modify(it, [this] (Entry& entry) {
+      entry.removalTime = time::steady_clock::now() + m_lifetime;
+    });
+    return;
+  }
+
+  if (m_entries.size() >= m_capacity) {
+    m_entries.pop_front();
+  }
+  m_entries.push_back({fullName, time::steady_clock::now() + m_lifetime});
+}
+
+bool
+ValidationResultCache::contains(const Name& fullName)
+{
+  refresh();
+  return m_entries.get<1>().count(fullName) > 0;
+}
+
+void
+ValidationResultCache::clear()
+{
+  m_entries.clear();
+}
+
+void
+ValidationResultCache::refresh()
+{
+  auto now = time::steady_clock::now();
+  while (!m_entries.empty() && m_entries.front().removalTime <= now) {
+    m_entries.pop_front();
+  }
+}
+
+} // namespace ndn::security
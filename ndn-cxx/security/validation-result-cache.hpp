@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_VALIDATION_RESULT_CACHE_HPP
+#define NDN_CXX_SECURITY_VALIDATION_RESULT_CACHE_HPP
+
+#include "ndn-cxx/name.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+
+namespace ndn::security {
+
+/**
+ * @brief Remembers the full names of packets that have been successfully validated.
+ *
+ * An entry is removed @p lifetime after it has been inserted, or earlier if the cache is full
+ * and the entry is the oldest one.
+ */
+class ValidationResultCache : noncopyable
+{
+public:
+  /**
+   * @param capacity maximum number of entries, must be positive
+   * @param lifetime how long a validation result is remembered
+   */
+  ValidationResultCache(size_t capacity, time::nanoseconds lifetime);
+
+  /**
+   * @brief Record a successful validation of the packet with full name @p fullName.
+   */
+  void
+  insert(const Name& fullName);
+
+  /**
+   * @brief Return whether a successful validation of @p fullName is remembered.
+   */
+  bool
+  contains(const Name& fullName);
+
+  /**
+   * @brief Remove all entries.
+   */
+  void
+  clear();
+
+  size_t
+  size() const
+  {
+    return m_entries.size();
+  }
+
+  size_t
+  getCapacity() const
+  {
+    return m_capacity;
+  }
+
+  time::nanoseconds
+  getLifetime() const
+  {
+    return m_lifetime;
+  }
+
+private:
+  struct Entry
+  {
+    Name fullName;
+    time::steady_clock::time_point removalTime;
+  };
+
+  /**
+   * @brief Remove all expired entries.
+   */
+  void
+  refresh();
+
+private:
+  // entries are kept in insertion order, which is also the order of their removal times
+  using EntryIndex = boost::multi_index::multi_index_container<
+    Entry,
+    boost::multi_index::indexed_by<
+      boost::multi_index::sequenced<>,
+      boost::multi_index::hashed_unique<
+        boost::multi_index::member<Entry, Name, &Entry::fullName>,
+        std::hash<Name>
+      >
+    >
+  >;
+
+  EntryIndex m_entries;
+  const size_t m_capacity;
+  const time::nanoseconds m_lifetime;
+};
+
+} // namespace ndn::security
+
+#endif // NDN_CXX_SECURITY_VALIDATION_RESULT_CACHE_HPP
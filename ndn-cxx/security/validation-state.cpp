@@ -49,22 +49,50 @@ ValidationState::addCertificate(const Certificate& cert)
   m_certificateChain.push_front(cert);
 }
 
-const Certificate*
-ValidationState::verifyCertificateChain(const Certificate& trustedCert)
+static size_t
+countVerifiedCertificates(const std::list<Certificate>& chain, const Certificate& trustedCert)
 {
+  size_t nVerified = 0;
   const Certificate* validatedCert = &trustedCert;
-  for (auto it = m_certificateChain.begin(); it != m_certificateChain.end(); ++it) {
-    const auto& certToValidate = *it;
-
+  for (const auto& certToValidate : chain) {
     if (!verifySignature(certToValidate, *validatedCert)) {
-      this->fail({ValidationError::INVALID_SIGNATURE, "Certificate " + certToValidate.getName().toUri()});
-      m_certificateChain.erase(it, m_certificateChain.end());
-      return nullptr;
+      break;
     }
-
-    NDN_LOG_TRACE_DEPTH("OK signature for certificate `" << certToValidate.getName() << "`");
+    ++nVerified;
     validatedCert = &certToValidate;
   }
+  return nVerified;
+}
+
+const Certificate*
+ValidationState::verifyCertificateChain(const Certificate& trustedCert)
+{
+  return finishCertificateChain(trustedCert, countVerifiedCertificates(m_certificateChain, trustedCert));
+}
+
+std::function<size_t()>
+ValidationState::makeCertificateChainVerifier(const Certificate& trustedCert) const
+{
+  return [chain = m_certificateChain, trustedCert] {
+    return countVerifiedCertificates(chain, trustedCert);
+  };
+}
+
+const Certificate*
+ValidationState::finishCertificateChain(const Certificate& trustedCert, size_t nVerified)
+{
+  const Certificate* validatedCert = &trustedCert;
+  auto it = m_certificateChain.begin();
+  for (size_t i = 0; i < nVerified && it != m_certificateChain.end(); ++i, ++it) {
+    NDN_LOG_TRACE_DEPTH("OK signature for certificate `" << it->getName() << "`");
+    validatedCert = &*it;
+  }
+
+  if (it != m_certificateChain.end()) {
+    this->fail({ValidationError::INVALID_SIGNATURE, "Certificate " + it->getName().toUri()});
+    m_certificateChain.erase(it, m_certificateChain.end());
+    return nullptr;
+  }
   return validatedCert;
 }
 
@@ -92,7 +120,19 @@ DataValidationState::~DataValidationState()
 void
 DataValidationState::verifyOriginalPacket(const std::optional<Certificate>& trustedCert)
 {
-  if (verifySignature(m_data, trustedCert)) {
+  finishOriginalPacket(verifySignature(m_data, trustedCert));
+}
+
+std::function<bool()>
+DataValidationState::makeOriginalPacketVerifier(const std::optional<Certificate>& trustedCert) const
+{
+  return [data = m_data, trustedCert] { return verifySignature(data, trustedCert); };
+}
+
+void
+DataValidationState::finishOriginalPacket(bool isVerified)
+{
+  if (isVerified) {
     NDN_LOG_TRACE_DEPTH("OK signature for data `" << m_data.getName() << "`");
     m_successCb(m_data);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
@@ -145,7 +185,19 @@ InterestValidationState::~InterestValidationState()
 void
 InterestValidationState::verifyOriginalPacket(const std::optional<Certificate>& trustedCert)
 {
-  if (verifySignature(m_interest, trustedCert)) {
+  finishOriginalPacket(verifySignature(m_interest, trustedCert));
+}
+
+std::function<bool()>
+InterestValidationState::makeOriginalPacketVerifier(const std::optional<Certificate>& trustedCert) const
+{
+  return [interest = m_interest, trustedCert] { return verifySignature(interest, trustedCert); };
+}
+
+void
+InterestValidationState::finishOriginalPacket(bool isVerified)
+{
+  if (isVerified) {
     NDN_LOG_TRACE_DEPTH("OK signature for interest `" << m_interest.getName() << "`");
     this->afterSuccess(m_interest);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
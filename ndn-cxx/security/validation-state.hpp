@@ -111,6 +111,22 @@ private: // Interface intended to be used only by Validator class
   virtual void
   verifyOriginalPacket(const std::optional<Certificate>& trustedCert) = 0;
 
+  /**
+   * @brief Return a function that verifies signature of the original packet
+   *
+   * The returned function operates on its own copies of the original packet and @p trustedCert,
+   * so that it can be invoked on a thread other than the one running the validator.  Its result
+   * must be passed to finishOriginalPacket() on the validator's thread.
+   */
+  virtual std::function<bool()>
+  makeOriginalPacketVerifier(const std::optional<Certificate>& trustedCert) const = 0;
+
+  /**
+   * @brief Call success or failure callback according to the result of signature verification
+   */
+  virtual void
+  finishOriginalPacket(bool isVerified) = 0;
+
   /**
    * @brief Call success callback of the original packet without signature validation
    */
@@ -134,6 +150,26 @@ private: // Interface intended to be used only by Validator class
   const Certificate*
   verifyCertificateChain(const Certificate& trustedCert);
 
+  /**
+   * @brief Return a function that verifies signatures of certificates in the certificate chain
+   *
+   * The returned function operates on its own copies of the certificate chain and @p trustedCert,
+   * so that it can be invoked on a thread other than the one running the validator.  It returns
+   * the number of certificates, starting from the one signed by @p trustedCert, whose signatures
+   * are valid.  Its result must be passed to finishCertificateChain() on the validator's thread.
+   */
+  std::function<size_t()>
+  makeCertificateChainVerifier(const Certificate& trustedCert) const;
+
+  /**
+   * @brief Complete verification of the certificate chain, given the number of certificates
+   *        whose signatures are valid
+   *
+   * @return same as verifyCertificateChain()
+   */
+  const Certificate*
+  finishCertificateChain(const Certificate& trustedCert, size_t nVerified);
+
 protected:
   boost::logic::tribool m_outcome{boost::logic::indeterminate};
 
@@ -191,6 +227,12 @@ private:
   void
   verifyOriginalPacket(const std::optional<Certificate>& trustedCert) final;
 
+  std::function<bool()>
+  makeOriginalPacketVerifier(const std::optional<Certificate>& trustedCert) const final;
+
+  void
+  finishOriginalPacket(bool isVerified) final;
+
   void
   bypassValidation() final;
 
@@ -243,6 +285,12 @@ private:
   void
   verifyOriginalPacket(const std::optional<Certificate>& trustedCert) final;
 
+  std::function<bool()>
+  makeOriginalPacketVerifier(const std::optional<Certificate>& trustedCert) const final;
+
+  void
+  finishOriginalPacket(bool isVerified) final;
+
   void
   bypassValidation() final;
 
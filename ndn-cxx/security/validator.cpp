@@ -22,6 +22,11 @@
 #include "ndn-cxx/security/validator.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
+#include <algorithm>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/lexical_cast.hpp>
 
 namespace ndn::security {
@@ -41,14 +46,76 @@ Validator::Validator(unique_ptr<ValidationPolicy> policy, unique_ptr<Certificate
   m_certFetcher->setCertificateStorage(*this);
 }
 
-Validator::~Validator() noexcept = default;
+Validator::~Validator() noexcept
+{
+  if (m_verificationPool != nullptr) {
+    m_verificationPool->join();
+  }
+}
+
+void
+Validator::setVerificationThreads(boost::asio::io_context& io, size_t nThreads)
+{
+  setVerificationExecutor(io, nullptr);
+  if (nThreads > 0) {
+    m_verificationPool = make_unique<boost::asio::thread_pool>(nThreads);
+    m_executor = [pool = m_verificationPool.get()] (std::function<void()> job) {
+      boost::asio::post(*pool, std::move(job));
+    };
+  }
+}
+
+void
+Validator::setVerificationExecutor(boost::asio::io_context& io, VerificationExecutor executor)
+{
+  if (m_verificationPool != nullptr) {
+    m_verificationPool->join();
+    m_verificationPool.reset();
+  }
+
+  m_io = &io;
+  m_executor = std::move(executor);
+}
+
+void
+Validator::setResultCache(size_t capacity, time::nanoseconds lifetime)
+{
+  ++m_resultCacheGeneration;
+  if (capacity == 0) {
+    m_resultCache.reset();
+  }
+  else {
+    m_resultCache = make_unique<ValidationResultCache>(capacity, lifetime);
+  }
+}
 
 void
 Validator::validate(const Data& data,
                     const DataValidationSuccessCallback& successCb,
                     const DataValidationFailureCallback& failureCb)
 {
-  auto state = make_shared<DataValidationState>(data, successCb, failureCb);
+  DataValidationSuccessCallback onSuccess = successCb;
+  if (m_resultCache != nullptr && data.hasWire()) {
+    auto fullName = data.getFullName();
+    if (m_resultCache->contains(fullName)) {
+      NDN_LOG_DEBUG("> Accepting data " << data.getName() << " validated earlier");
+      return successCb(data);
+    }
+
+    // the callback may be invoked from a posted handler, after the validator is destroyed,
+    // or after the cache has been cleared by a reset of the trusted certificates
+    onSuccess = [self = weak_ptr<Validator*>(m_self), generation = m_resultCacheGeneration,
+                 fullName, successCb] (const Data& data) {
+      if (auto validator = self.lock();
+          validator != nullptr && (*validator)->m_resultCacheGeneration == generation &&
+          (*validator)->m_resultCache != nullptr) {
+        (*validator)->m_resultCache->insert(fullName);
+      }
+      successCb(data);
+    };
+  }
+
+  auto state = make_shared<DataValidationState>(data, onSuccess, failureCb);
   NDN_LOG_DEBUG_DEPTH("Start validating data " << data.getName());
 
   m_policy->checkPolicy(data, state, [this] (auto&&... args) {
@@ -88,6 +155,13 @@ Validator::validate(const Certificate& cert, const shared_ptr<ValidationState>&
                         "between " + boost::lexical_cast<std::string>(cert.getValidityPeriod())});
   }
 
+  // another validation waiting for the same certificate may have verified it in the meantime
+  if (auto trustedCert = findTrustedCert(Interest(cert.getName()));
+      trustedCert != nullptr && *trustedCert == cert) {
+    NDN_LOG_TRACE_DEPTH("Certificate has been verified in the meantime");
+    return continueWithTrustedCert(state, *trustedCert);
+  }
+
   m_policy->checkPolicy(cert, state,
     [this, cert] (const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state) {
       if (certRequest == nullptr) {
@@ -127,6 +201,7 @@ Validator::requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
   }
 
   if (certRequest->interest.getName() == SigningInfo::getDigestSha256Identity()) {
+    // self-verifying signatures are cheap enough to be checked inline
     state->verifyOriginalPacket(std::nullopt);
     return;
   }
@@ -141,16 +216,7 @@ Validator::requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
   auto cert = findTrustedCert(certRequest->interest);
   if (cert != nullptr) {
     NDN_LOG_TRACE_DEPTH("Found trusted certificate " << cert->getName());
-
-    cert = state->verifyCertificateChain(*cert);
-    if (cert != nullptr) {
-      state->verifyOriginalPacket(*cert);
-    }
-    for (auto trustedCert = std::make_move_iterator(state->m_certificateChain.begin());
-         trustedCert != std::make_move_iterator(state->m_certificateChain.end());
-         ++trustedCert) {
-      cacheVerifiedCertificate(*trustedCert);
-    }
+    continueWithTrustedCert(state, *cert);
     return;
   }
 
@@ -159,6 +225,117 @@ Validator::requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
   });
 }
 
+void
+Validator::continueWithTrustedCert(const shared_ptr<ValidationState>& state, const Certificate& trustedCert)
+{
+  if (m_executor) {
+    return verifyWithExecutor(state, trustedCert);
+  }
+
+  auto cert = state->verifyCertificateChain(trustedCert);
+  if (cert != nullptr) {
+    state->verifyOriginalPacket(*cert);
+  }
+  cacheCertificateChain(*state);
+}
+
+void
+Validator::verifyWithExecutor(const shared_ptr<ValidationState>& state, const Certificate& trustedCert)
+{
+  const auto& chain = state->m_certificateChain;
+  // the last certificate of the chain signs the original packet
+  auto verifyPacket = state->makeOriginalPacketVerifier(chain.empty() ? trustedCert : chain.back());
+
+  if (chain.empty()) {
+    // only the packet is verified, which cannot be shared with other validations
+    VerificationBatch batch{{}, trustedCert, 0, state->makeCertificateChainVerifier(trustedCert), {}};
+    batch.packets.emplace_back(state, std::move(verifyPacket));
+    return submitVerification(std::move(batch));
+  }
+
+  std::vector<Name> certNames;
+  for (const auto& cert : chain) {
+    certNames.push_back(cert.getFullName());
+  }
+  certNames.push_back(trustedCert.getFullName());
+
+  if (m_pendingBatches == nullptr) {
+    // the validations resumed by a fetched certificate all get here before the handler returns
+    m_pendingBatches = make_shared<std::vector<VerificationBatch>>();
+    boost::asio::post(*m_io, [self = weak_ptr<Validator*>(m_self), batches = m_pendingBatches] {
+      auto validator = self.lock();
+      if (validator == nullptr) {
+        for (const auto& batch : *batches) {
+          for (const auto& packet : batch.packets) {
+            packet.first->fail({ValidationError::IMPLEMENTATION_ERROR, "Validator destroyed"});
+          }
+        }
+        return;
+      }
+      (*validator)->m_pendingBatches = nullptr;
+      for (auto& batch : *batches) {
+        (*validator)->submitVerification(std::move(batch));
+      }
+    });
+  }
+
+  auto batch = std::find_if(m_pendingBatches->begin(), m_pendingBatches->end(),
+                            [&] (const auto& b) { return b.certNames == certNames; });
+  if (batch == m_pendingBatches->end()) {
+    m_pendingBatches->push_back({std::move(certNames), trustedCert, chain.size(),
+                                 state->makeCertificateChainVerifier(trustedCert), {}});
+    batch = std::prev(m_pendingBatches->end());
+  }
+  batch->packets.emplace_back(state, std::move(verifyPacket));
+}
+
+void
+Validator::submitVerification(VerificationBatch&& batch)
+{
+  auto job = [io = m_io, self = weak_ptr<Validator*>(m_self), batch = std::move(batch)] () mutable {
+    size_t nVerified = batch.verifyChain();
+    std::vector<bool> isVerified;
+    for (const auto& packet : batch.packets) {
+      isVerified.push_back(nVerified == batch.chainSize && packet.second());
+    }
+    // the states are released on the validator's thread, where their callbacks may be invoked
+    boost::asio::post(*io, [self = std::move(self), batch = std::move(batch), nVerified,
+                            isVerified = std::move(isVerified)] {
+      auto validator = self.lock();
+      for (size_t i = 0; i < batch.packets.size(); ++i) {
+        const auto& state = batch.packets[i].first;
+        if (validator == nullptr) {
+          // the state must still report an outcome, even without a validator to cache the chain
+          state->fail({ValidationError::IMPLEMENTATION_ERROR, "Validator destroyed"});
+          continue;
+        }
+        if (state->finishCertificateChain(batch.trustedCert, nVerified) != nullptr) {
+          state->finishOriginalPacket(isVerified[i]);
+        }
+        (*validator)->cacheCertificateChain(*state);
+      }
+    });
+  };
+
+  if (m_executor) {
+    m_executor(std::move(job));
+  }
+  else {
+    // synchronous verification was restored while the batch was pending
+    job();
+  }
+}
+
+void
+Validator::cacheCertificateChain(ValidationState& state)
+{
+  for (auto cert = std::make_move_iterator(state.m_certificateChain.begin());
+       cert != std::make_move_iterator(state.m_certificateChain.end());
+       ++cert) {
+    cacheVerifiedCertificate(*cert);
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////
 // Trust anchor management
 ////////////////////////////////////////////////////////////////////////
@@ -182,6 +359,7 @@ void
 Validator::resetAnchors()
 {
   CertificateStorage::resetAnchors();
+  clearResultCache();
 }
 
 void
@@ -194,6 +372,17 @@ void
 Validator::resetVerifiedCertificates()
 {
   CertificateStorage::resetVerifiedCerts();
+  clearResultCache();
+}
+
+void
+Validator::clearResultCache()
+{
+  // validations in progress must not insert their results after the cache is cleared
+  ++m_resultCacheGeneration;
+  if (m_resultCache != nullptr) {
+    m_resultCache->clear();
+  }
 }
 
 } // namespace ndn::security
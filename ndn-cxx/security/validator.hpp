@@ -22,11 +22,13 @@
 #ifndef NDN_CXX_SECURITY_VALIDATOR_HPP
 #define NDN_CXX_SECURITY_VALIDATOR_HPP
 
+#include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/security/certificate-fetcher.hpp"
 #include "ndn-cxx/security/certificate-request.hpp"
 #include "ndn-cxx/security/certificate-storage.hpp"
 #include "ndn-cxx/security/validation-callback.hpp"
 #include "ndn-cxx/security/validation-policy.hpp"
+#include "ndn-cxx/security/validation-result-cache.hpp"
 #include "ndn-cxx/security/validation-state.hpp"
 
 namespace ndn {
@@ -100,6 +102,68 @@ public:
     m_maxDepth = depth;
   }
 
+  /**
+   * @brief Function that runs a signature verification job, typically on another thread.
+   *
+   * The job only accesses its own copies of packets and certificates.
+   */
+  using VerificationExecutor = std::function<void(std::function<void()> job)>;
+
+  /**
+   * @brief Verify signatures of validated packets on a pool of worker threads.
+   *
+   * When enabled, once the certificate chain of a Data or Interest packet passed to validate()
+   * has been retrieved, the signatures of the certificates in the chain and of the packet itself
+   * are checked on one of @p nThreads worker threads, and the validation then completes on @p io,
+   * where the success or failure callback is invoked.  The policy and certificate retrieval still
+   * run on the calling thread, as does the check of self-verifying signatures such as
+   * DigestSha256.  Because verifications complete independently, validation callbacks may be
+   * invoked in a different order than the packets were passed to validate().  A certificate chain
+   * that had to be retrieved is verified once the current handler of @p io returns, in one job
+   * shared by all validations waiting for the same chain.
+   *
+   * @param io       io_context that runs the validator; it must outlive the validator
+   * @param nThreads number of worker threads; zero restores synchronous verification
+   *
+   * @note Pending verifications are completed before this function or the destructor returns,
+   *       but their callbacks are invoked only when @p io is run.
+   */
+  void
+  setVerificationThreads(boost::asio::io_context& io, size_t nThreads);
+
+  /**
+   * @brief Verify signatures of validated packets with an application-provided executor.
+   *
+   * Same as setVerificationThreads(), except that verification jobs are passed to @p executor,
+   * e.g., to share a thread pool with other parts of the application.  The executor must run
+   * every job exactly once.  A job that completes after the validator has been destroyed is
+   * discarded, and the validation fails.
+   *
+   * @param io       io_context that runs the validator; it must outlive all verification jobs
+   * @param executor runs verification jobs; nullptr restores synchronous verification
+   */
+  void
+  setVerificationExecutor(boost::asio::io_context& io, VerificationExecutor executor);
+
+  /**
+   * @brief Remember successfully validated Data packets for a limited time.
+   *
+   * When enabled, a Data packet received from the network whose full name, including the
+   * implicit digest, matches a packet that was successfully validated within @p lifetime is
+   * accepted immediately, without running the policy or verifying any signature.  Failures are
+   * not remembered.  Interest packets are always fully validated, because validation policies
+   * for signed Interests may reject replayed packets.
+   *
+   * The cache is cleared by resetAnchors() and resetVerifiedCertificates(), but a remembered
+   * result is not revoked when a certificate of its chain expires, so @p lifetime should be
+   * short compared to the validity period of certificates.
+   *
+   * @param capacity maximum number of remembered packets; zero disables the cache
+   * @param lifetime how long a successful validation is remembered
+   */
+  void
+  setResultCache(size_t capacity, time::nanoseconds lifetime = 1_s);
+
   /**
    * @brief Asynchronously validate @p data.
    *
@@ -197,10 +261,74 @@ private: // Common validator operations
   requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
                      const shared_ptr<ValidationState>& state);
 
+  /**
+   * @brief Verify signatures of the certificate chain and of the original packet, starting
+   *        from a trusted certificate.
+   *
+   * @param state        The current validation state.
+   * @param trustedCert  The trusted certificate that signs the first certificate of the chain,
+   *                     or the original packet if the chain is empty.
+   */
+  void
+  continueWithTrustedCert(const shared_ptr<ValidationState>& state, const Certificate& trustedCert);
+
+  /**
+   * @brief Verify signatures of the certificate chain and of the original packet with the
+   *        verification executor, then complete the validation on the validator's thread.
+   *
+   * @param state        The current validation state.
+   * @param trustedCert  The trusted certificate that signs the first certificate of the chain,
+   *                     or the original packet if the chain is empty.
+   */
+  void
+  verifyWithExecutor(const shared_ptr<ValidationState>& state, const Certificate& trustedCert);
+
+  /**
+   * @brief Signature verifications that share the same certificate chain.
+   */
+  struct VerificationBatch
+  {
+    /// full names of the certificates in the chain, followed by that of the trusted certificate
+    std::vector<Name> certNames;
+    Certificate trustedCert;
+    size_t chainSize = 0;
+    std::function<size_t()> verifyChain;
+    /// validations whose original packet is signed by the last certificate of the chain
+    std::vector<std::pair<shared_ptr<ValidationState>, std::function<bool()>>> packets;
+  };
+
+  /**
+   * @brief Pass a job that verifies the chain of @p batch once, then each of its packets, to the
+   *        verification executor, and complete the validations on the validator's thread.
+   */
+  void
+  submitVerification(VerificationBatch&& batch);
+
+  /**
+   * @brief Cache the certificates of the chain that have been verified.
+   */
+  void
+  cacheCertificateChain(ValidationState& state);
+
+  void
+  clearResultCache();
+
 private:
   unique_ptr<ValidationPolicy> m_policy;
   unique_ptr<CertificateFetcher> m_certFetcher;
   size_t m_maxDepth{25};
+  unique_ptr<ValidationResultCache> m_resultCache;
+  /// incremented whenever the result cache is cleared or replaced
+  uint64_t m_resultCacheGeneration = 0;
+  boost::asio::io_context* m_io = nullptr;
+  VerificationExecutor m_executor;
+  /// chains to verify once the current handler returns, so that the validations resumed together
+  /// by a coalesced certificate fetch share one verification job
+  shared_ptr<std::vector<VerificationBatch>> m_pendingBatches;
+  /// observed by verification jobs, which are discarded after the validator is destroyed
+  shared_ptr<Validator*> m_self = make_shared<Validator*>(this);
+  // declared last, so that worker threads are joined before other members are destroyed
+  unique_ptr<boost::asio::thread_pool> m_verificationPool;
 };
 
 } // namespace security
@@ -23,6 +23,7 @@
 #define NDN_CXX_TRANSPORT_DETAIL_STREAM_TRANSPORT_IMPL_HPP
 
 #include "ndn-cxx/transport/transport.hpp"
+#include "ndn-cxx/util/packet-tracer.hpp"
 
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/write.hpp>
@@ -93,6 +94,7 @@ public:
     m_socket.close(error);
 
     TransmissionQueue{}.swap(m_transmissionQueue); // clear the queue
+    updateSendQueueLength();
   }
 
   void
@@ -118,6 +120,8 @@ public:
   send(const Block& block)
   {
     m_transmissionQueue.push(block);
+    updateSendQueueLength();
+    util::PacketTracer::record(util::PacketTraceEvent::TRANSPORT_SEND, block.size());
 
     if (m_transport.getState() != Transport::State::CLOSED &&
         m_transport.getState() != Transport::State::CONNECTING &&
@@ -174,6 +178,7 @@ protected:
 
         BOOST_ASSERT(!m_transmissionQueue.empty());
         m_transmissionQueue.pop();
+        updateSendQueueLength();
 
         if (!m_transmissionQueue.empty()) {
           asyncWrite();
@@ -205,6 +210,7 @@ protected:
             break;
           }
           unparsedBytes = unparsedBytes.subspan(element.size());
+          util::PacketTracer::record(util::PacketTraceEvent::TRANSPORT_RECV, element.size());
           m_transport.m_receiveCallback(element);
         }
 
@@ -226,6 +232,12 @@ protected:
       });
   }
 
+  void
+  updateSendQueueLength() noexcept
+  {
+    m_transport.m_sendQueueLength.store(m_transmissionQueue.size(), std::memory_order_relaxed);
+  }
+
 protected:
   BaseTransport& m_transport;
   typename Protocol::endpoint m_endpoint;
@@ -28,6 +28,8 @@
 
 #include <boost/system/error_code.hpp>
 
+#include <atomic>
+
 namespace ndn {
 
 /**
@@ -105,6 +107,16 @@ public:
     return m_state;
   }
 
+  /**
+   * \brief Return the number of TLV blocks waiting to be written to the connection.
+   * \note This method can be called from any thread.
+   */
+  size_t
+  getSendQueueLength() const noexcept
+  {
+    return m_sendQueueLength.load(std::memory_order_relaxed);
+  }
+
 protected:
   void
   setState(State state) noexcept
@@ -115,6 +127,7 @@ protected:
 protected:
   boost::asio::io_context* m_ioCtx = nullptr;
   ReceiveCallback m_receiveCallback;
+  std::atomic<size_t> m_sendQueueLength{0};
 
 private:
   State m_state = State::CLOSED;
@@ -0,0 +1,300 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/congestion-control.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ndn::util {
+
+static double
+toSeconds(time::nanoseconds d)
+{
+  return static_cast<double>(d.count()) / 1e9;
+}
+
+std::ostream&
+operator<<(std::ostream& os, CongestionControlAlgorithm algorithm)
+{
+  switch (algorithm) {
+    case CongestionControlAlgorithm::AIMD:
+      return os << "AIMD";
+    case CongestionControlAlgorithm::CUBIC:
+      return os << "CUBIC";
+    case CongestionControlAlgorithm::BBR:
+      return os << "BBR";
+  }
+  return os << "unknown(" << static_cast<int>(algorithm) << ')';
+}
+
+CongestionControl::CongestionControl(const Options& options)
+  : m_options(options)
+  , m_cwnd(options.initCwnd)
+  , m_ssthresh(options.initSsthresh)
+{
+}
+
+CongestionControl::~CongestionControl() = default;
+
+unique_ptr<CongestionControl>
+makeCongestionControl(CongestionControlAlgorithm algorithm,
+                      const CongestionControl::Options& options)
+{
+  switch (algorithm) {
+    case CongestionControlAlgorithm::AIMD:
+      return make_unique<AimdCongestionControl>(options);
+    case CongestionControlAlgorithm::CUBIC:
+      return make_unique<CubicCongestionControl>(options);
+    case CongestionControlAlgorithm::BBR:
+      return make_unique<BbrCongestionControl>(options);
+  }
+  NDN_THROW(std::invalid_argument("Unknown congestion control algorithm"));
+}
+
+AimdCongestionControl::AimdCongestionControl(const Options& options)
+  : CongestionControl(options)
+{
+}
+
+void
+AimdCongestionControl::afterReceiveData(std::optional<time::nanoseconds>)
+{
+  if (m_cwnd < m_ssthresh) {
+    m_cwnd += m_options.aiStep; // additive increase
+  }
+  else {
+    m_cwnd += m_options.aiStep / std::floor(m_cwnd); // congestion avoidance
+  }
+}
+
+void
+AimdCongestionControl::afterCongestionEvent()
+{
+  // Refer to RFC 5681, Section 3.1 for the rationale behind the code below
+  m_ssthresh = std::max(MIN_SSTHRESH, m_cwnd * m_options.mdCoef); // multiplicative decrease
+  m_cwnd = m_options.resetCwndToInit ? m_options.initCwnd : m_ssthresh;
+}
+
+CubicCongestionControl::CubicCongestionControl(const Options& options)
+  : CongestionControl(options)
+  , m_roundStart(time::steady_clock::now())
+{
+}
+
+void
+CubicCongestionControl::afterReceiveData(std::optional<time::nanoseconds> rtt)
+{
+  if (rtt) {
+    m_sRtt = m_sRtt == 0_ns ? *rtt : (m_sRtt * 7 + *rtt) / 8;
+  }
+
+  if (m_cwnd < m_ssthresh) {
+    return increaseInSlowStart(rtt);
+  }
+
+  auto now = time::steady_clock::now();
+  if (!m_isEpochStarted) {
+    // first acknowledgment in congestion avoidance since the last congestion event
+    m_isEpochStarted = true;
+    m_epochStart = now;
+    if (m_cwnd < m_wMax) {
+      m_k = std::cbrt((m_wMax - m_cwnd) / C);
+    }
+    else {
+      m_k = 0.0;
+      m_wMax = m_cwnd;
+    }
+    m_wEst = m_cwnd;
+  }
+
+  // RFC 9438, Section 4.3: stay at least as aggressive as an AIMD flow. Below the window of the
+  // last reduction, the additive increase is scaled so that, with the gentler decrease by BETA,
+  // the average window matches that of Reno; above it, the increase is one segment per RTT.
+  double alpha = m_wEst < m_cwndPrior ? 3.0 * (1.0 - BETA) / (1.0 + BETA) : 1.0;
+  m_wEst += alpha / m_cwnd;
+
+  // W_cubic(t) is in segments, with t and K in seconds
+  double t = toSeconds(now - m_epochStart);
+  if (C * std::pow(t - m_k, 3) + m_wMax < m_wEst) {
+    m_cwnd = std::max(m_cwnd, m_wEst);
+    return;
+  }
+
+  // RFC 9438, Section 4.2: the target is the window one RTT in the future
+  double target = C * std::pow(t + toSeconds(m_sRtt) - m_k, 3) + m_wMax;
+  target = std::clamp(target, m_cwnd, 1.5 * m_cwnd);
+  m_cwnd += (target - m_cwnd) / m_cwnd;
+}
+
+void
+CubicCongestionControl::afterCongestionEvent()
+{
+  m_isEpochStarted = false;
+  m_isInCss = false;
+  m_cwndPrior = m_cwnd;
+
+  // RFC 9438, Section 4.7: fast convergence
+  if (m_cwnd < m_wMax) {
+    m_wMax = m_cwnd * (1.0 + BETA) / 2.0;
+  }
+  else {
+    m_wMax = m_cwnd;
+  }
+
+  m_ssthresh = std::max(MIN_SSTHRESH, m_cwnd * BETA);
+  m_cwnd = m_ssthresh;
+}
+
+void
+CubicCongestionControl::increaseInSlowStart(std::optional<time::nanoseconds> rtt)
+{
+  // RFC 9406, Section 4.2, with rounds delimited by the smoothed RTT rather than by sequence
+  // numbers, which are not known to the controller
+  auto now = time::steady_clock::now();
+  if (now - m_roundStart >= m_sRtt) {
+    m_lastRoundMinRtt = m_currentRoundMinRtt;
+    m_currentRoundMinRtt = time::nanoseconds::max();
+    m_nRttSamplesInRound = 0;
+    m_roundStart = now;
+
+    if (m_isInCss && ++m_nCssRounds >= CSS_ROUNDS) {
+      // the RTT increase persisted, enter congestion avoidance
+      m_isInCss = false;
+      m_ssthresh = m_cwnd;
+      return;
+    }
+  }
+
+  if (rtt) {
+    m_currentRoundMinRtt = std::min(m_currentRoundMinRtt, *rtt);
+    ++m_nRttSamplesInRound;
+  }
+  bool hasEnoughSamples = m_nRttSamplesInRound >= N_RTT_SAMPLE &&
+                          m_currentRoundMinRtt != time::nanoseconds::max() &&
+                          m_lastRoundMinRtt != time::nanoseconds::max();
+
+  if (!m_isInCss) {
+    m_cwnd += 1.0;
+    if (hasEnoughSamples) {
+      auto thresh = std::clamp(m_lastRoundMinRtt / 8, MIN_RTT_THRESH, MAX_RTT_THRESH);
+      if (m_currentRoundMinRtt >= m_lastRoundMinRtt + thresh) {
+        m_isInCss = true;
+        m_cssBaselineMinRtt = m_currentRoundMinRtt;
+        m_nCssRounds = 0;
+      }
+    }
+  }
+  else {
+    m_cwnd += 1.0 / CSS_GROWTH_DIVISOR;
+    if (hasEnoughSamples && m_currentRoundMinRtt < m_cssBaselineMinRtt) {
+      // the RTT increase was spurious, resume slow start
+      m_isInCss = false;
+    }
+  }
+}
+
+BbrCongestionControl::BbrCongestionControl(const Options& options)
+  : CongestionControl(options)
+  , m_roundStart(time::steady_clock::now())
+{
+}
+
+double
+BbrCongestionControl::getBandwidth() const noexcept
+{
+  return *std::max_element(m_rates.begin(), m_rates.end());
+}
+
+void
+BbrCongestionControl::afterReceiveData(std::optional<time::nanoseconds> rtt)
+{
+  auto now = time::steady_clock::now();
+  if (rtt && (*rtt <= m_minRtt || now - m_minRttTimestamp > MIN_RTT_WINDOW)) {
+    m_minRtt = *rtt;
+    m_minRttTimestamp = now;
+  }
+
+  ++m_nDeliveredInRound;
+  // a round lasts at least one propagation delay, but never zero time, so that the measured
+  // delivery rate stays finite when RTT samples are zero, e.g., with a local producer
+  if (m_minRtt != time::nanoseconds::max() &&
+      now - m_roundStart >= std::max(m_minRtt, MIN_ROUND_DURATION)) {
+    startRound(now);
+  }
+
+  if (m_isStartup) {
+    m_cwnd += 1.0; // double the window every round trip
+  }
+  else {
+    updateCwnd();
+  }
+}
+
+void
+BbrCongestionControl::afterCongestionEvent()
+{
+  if (m_isStartup) {
+    m_isStartup = false;
+    if (getBandwidth() > 0.0) {
+      updateCwnd();
+    }
+    else {
+      m_cwnd = std::max(MIN_CWND, m_cwnd / 2.0);
+    }
+  }
+}
+
+void
+BbrCongestionControl::startRound(time::steady_clock::time_point now)
+{
+  // the delivery rate of the round that just ended
+  double duration = toSeconds(now - m_roundStart);
+  m_rates[m_nRounds % m_rates.size()] = static_cast<double>(m_nDeliveredInRound) / duration;
+  ++m_nRounds;
+  m_nDeliveredInRound = 0;
+  m_roundStart = now;
+
+  if (m_isStartup) {
+    // leave startup once the bandwidth has stopped growing by 25% for three rounds
+    double bandwidth = getBandwidth();
+    if (bandwidth >= m_fullBandwidth * 1.25) {
+      m_fullBandwidth = bandwidth;
+      m_nRoundsWithoutGrowth = 0;
+    }
+    else if (++m_nRoundsWithoutGrowth >= 3) {
+      m_isStartup = false;
+    }
+  }
+  else {
+    m_probePhase = (m_probePhase + 1) % PROBE_GAINS.size();
+  }
+}
+
+void
+BbrCongestionControl::updateCwnd()
+{
+  double minRtt = toSeconds(m_minRtt);
+  double bdp = getBandwidth() * minRtt;
+  m_cwnd = std::max(MIN_CWND, CWND_GAIN * PROBE_GAINS[m_probePhase] * bdp);
+}
+
+} // namespace ndn::util
@@ -0,0 +1,270 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_CONGESTION_CONTROL_HPP
+#define NDN_CXX_UTIL_CONGESTION_CONTROL_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <array>
+#include <limits>
+#include <optional>
+
+namespace ndn::util {
+
+/**
+ * @brief Congestion control algorithms provided by the library.
+ */
+enum class CongestionControlAlgorithm {
+  AIMD,  ///< additive increase, multiplicative decrease, see AimdCongestionControl
+  CUBIC, ///< CUBIC (RFC 9438), see CubicCongestionControl
+  BBR,   ///< delay-based model of the path, see BbrCongestionControl
+};
+
+std::ostream&
+operator<<(std::ostream& os, CongestionControlAlgorithm algorithm);
+
+/**
+ * @brief Window-based congestion controller for a consumer.
+ *
+ * The controller maintains a congestion window (cwnd), i.e., the number of Interests that may be
+ * in flight at any time. It is informed of every received Data packet and of every congestion
+ * event, which is either a loss (timeout or Nack) or a congestion mark. The caller is responsible
+ * for reacting to at most one congestion event per round trip, as in RFC 5681, Section 3.1.
+ */
+class CongestionControl : noncopyable
+{
+public:
+  struct Options
+  {
+    double initCwnd = 1.0;     ///< initial congestion window size
+    double initSsthresh = std::numeric_limits<double>::max(); ///< initial slow start threshold
+    double aiStep = 1.0;       ///< additive increase step (in segments), for AIMD
+    double mdCoef = 0.5;       ///< multiplicative decrease coefficient, for AIMD
+    bool resetCwndToInit = false; ///< reduce cwnd to #initCwnd upon a congestion event, for AIMD
+  };
+
+  virtual
+  ~CongestionControl();
+
+  /**
+   * @brief Returns the congestion window size, in segments.
+   */
+  double
+  getCwnd() const noexcept
+  {
+    return m_cwnd;
+  }
+
+  /**
+   * @brief Returns the slow start threshold, in segments.
+   */
+  double
+  getSsthresh() const noexcept
+  {
+    return m_ssthresh;
+  }
+
+  /**
+   * @brief Called when a Data packet is received.
+   * @param rtt RTT sample, or std::nullopt if the Interest was retransmitted (Karn's algorithm)
+   */
+  virtual void
+  afterReceiveData(std::optional<time::nanoseconds> rtt) = 0;
+
+  /**
+   * @brief Called upon a congestion event.
+   */
+  virtual void
+  afterCongestionEvent() = 0;
+
+protected:
+  explicit
+  CongestionControl(const Options& options);
+
+public:
+  static constexpr double MIN_SSTHRESH = 2.0;
+
+protected:
+  const Options m_options;
+  double m_cwnd;
+  double m_ssthresh;
+};
+
+/**
+ * @brief Creates a congestion controller that implements @p algorithm.
+ */
+unique_ptr<CongestionControl>
+makeCongestionControl(CongestionControlAlgorithm algorithm,
+                      const CongestionControl::Options& options = {});
+
+/**
+ * @brief Additive increase, multiplicative decrease with slow start.
+ *
+ * The window grows by Options::aiStep per Data packet in slow start and by Options::aiStep per
+ * round trip in congestion avoidance. Upon a congestion event, it is multiplied by
+ * Options::mdCoef.
+ */
+class AimdCongestionControl final : public CongestionControl
+{
+public:
+  explicit
+  AimdCongestionControl(const Options& options = {});
+
+  void
+  afterReceiveData(std::optional<time::nanoseconds> rtt) final;
+
+  void
+  afterCongestionEvent() final;
+};
+
+/**
+ * @brief CUBIC congestion control, as specified in RFC 9438.
+ *
+ * In congestion avoidance, the window follows a cubic function of the time elapsed since the
+ * last congestion event, centered on the window size at which that event occurred. This makes
+ * window growth independent of the RTT and much faster than AIMD on high-BDP paths.
+ *
+ * Slow start follows HyStart++ (RFC 9406): once the minimum RTT of a round exceeds that of the
+ * previous round by a fraction, i.e., once a queue starts to build up, the window grows four
+ * times more slowly for a few rounds, then enters congestion avoidance unless the RTT went back
+ * down. This avoids overshooting until the bottleneck queue overflows.
+ */
+class CubicCongestionControl final : public CongestionControl
+{
+public:
+  explicit
+  CubicCongestionControl(const Options& options = {});
+
+  void
+  afterReceiveData(std::optional<time::nanoseconds> rtt) final;
+
+  void
+  afterCongestionEvent() final;
+
+private:
+  void
+  increaseInSlowStart(std::optional<time::nanoseconds> rtt);
+
+public:
+  static constexpr double C = 0.4;
+  static constexpr double BETA = 0.7;
+  // HyStart++ parameters, see RFC 9406, Section 4.3
+  static constexpr time::nanoseconds MIN_RTT_THRESH = 4_ms;
+  static constexpr time::nanoseconds MAX_RTT_THRESH = 16_ms;
+  static constexpr size_t N_RTT_SAMPLE = 8;
+  static constexpr double CSS_GROWTH_DIVISOR = 4.0;
+  static constexpr size_t CSS_ROUNDS = 5;
+
+private:
+  double m_cwndPrior = 0.0; ///< window size before the last reduction
+  double m_wMax = 0.0;      ///< m_cwndPrior, lowered by fast convergence
+  double m_k = 0.0;         ///< seconds until the window reaches m_wMax again
+  double m_wEst = 0.0;      ///< estimated window of an equivalent AIMD flow
+  time::steady_clock::time_point m_epochStart;
+  bool m_isEpochStarted = false;
+  time::nanoseconds m_sRtt = 0_ns;
+
+  time::steady_clock::time_point m_roundStart;
+  time::nanoseconds m_lastRoundMinRtt = time::nanoseconds::max();
+  time::nanoseconds m_currentRoundMinRtt = time::nanoseconds::max();
+  size_t m_nRttSamplesInRound = 0;
+  bool m_isInCss = false; ///< in conservative slow start
+  time::nanoseconds m_cssBaselineMinRtt = time::nanoseconds::max();
+  size_t m_nCssRounds = 0;
+};
+
+/**
+ * @brief Delay-based congestion control modeled after BBR.
+ *
+ * The controller estimates the bottleneck bandwidth, as the maximum delivery rate over the last
+ * few rounds, and the propagation delay, as the minimum RTT over the last 10 seconds. The window
+ * is set to twice their product, i.e., the bandwidth-delay product (BDP), and periodically
+ * scaled up and down to probe for more bandwidth. Losses and congestion marks do not reduce
+ * the window, except to end the initial exponential growth (startup).
+ */
+class BbrCongestionControl final : public CongestionControl
+{
+public:
+  explicit
+  BbrCongestionControl(const Options& options = {});
+
+  void
+  afterReceiveData(std::optional<time::nanoseconds> rtt) final;
+
+  void
+  afterCongestionEvent() final;
+
+  /**
+   * @brief Returns the estimated bottleneck bandwidth, in segments per second.
+   */
+  double
+  getBandwidth() const noexcept;
+
+  /**
+   * @brief Returns the estimated propagation delay.
+   */
+  time::nanoseconds
+  getMinRtt() const noexcept
+  {
+    return m_minRtt;
+  }
+
+  bool
+  isInStartup() const noexcept
+  {
+    return m_isStartup;
+  }
+
+private:
+  void
+  startRound(time::steady_clock::time_point now);
+
+  void
+  updateCwnd();
+
+public:
+  static constexpr double CWND_GAIN = 2.0;
+  static constexpr double MIN_CWND = 4.0;
+  static constexpr time::nanoseconds MIN_RTT_WINDOW = 10_s;
+  static constexpr time::nanoseconds MIN_ROUND_DURATION = 1_ms;
+  static constexpr std::array<double, 8> PROBE_GAINS{1.25, 0.75, 1, 1, 1, 1, 1, 1};
+
+private:
+  bool m_isStartup = true;
+  size_t m_nRoundsWithoutGrowth = 0;
+  double m_fullBandwidth = 0.0;
+  size_t m_probePhase = 0;
+
+  time::nanoseconds m_minRtt = time::nanoseconds::max();
+  time::steady_clock::time_point m_minRttTimestamp;
+
+  /// delivery rate (segments per second) measured in each of the last rounds
+  std::array<double, 10> m_rates{};
+  size_t m_nRounds = 0;
+  time::steady_clock::time_point m_roundStart;
+  uint64_t m_nDeliveredInRound = 0;
+};
+
+} // namespace ndn::util
+
+#endif // NDN_CXX_UTIL_CONGESTION_CONTROL_HPP
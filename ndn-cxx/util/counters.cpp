@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/counters.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ndn::util {
+
+void
+LatencyHistogram::add(time::nanoseconds sample) noexcept
+{
+  auto ns = static_cast<uint64_t>(std::max<time::nanoseconds::rep>(sample.count(), 0));
+  uint64_t us = ns / 1000;
+
+  size_t i = 0;
+  while (us > 1 && i < N_BUCKETS - 1) {
+    us >>= 1;
+    ++i;
+  }
+
+  ++m_buckets[i];
+  ++m_count;
+  m_sumNs += ns;
+}
+
+time::nanoseconds
+LatencyHistogram::getBucketUpperBound(size_t i) noexcept
+{
+  BOOST_ASSERT(i < N_BUCKETS);
+  if (i == N_BUCKETS - 1) {
+    return time::nanoseconds::max();
+  }
+  return time::microseconds(uint64_t{2} << i);
+}
+
+time::nanoseconds
+LatencyHistogram::getQuantile(double q) const noexcept
+{
+  BOOST_ASSERT(q >= 0.0 && q <= 1.0);
+
+  std::array<uint64_t, N_BUCKETS> counts;
+  uint64_t total = 0;
+  for (size_t i = 0; i < N_BUCKETS; ++i) {
+    counts[i] = m_buckets[i].get();
+    total += counts[i];
+  }
+  if (total == 0) {
+    return 0_ns;
+  }
+
+  auto rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(total)));
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < N_BUCKETS; ++i) {
+    cumulative += counts[i];
+    if (cumulative >= rank && cumulative > 0) {
+      return getBucketUpperBound(i);
+    }
+  }
+  return getBucketUpperBound(N_BUCKETS - 1);
+}
+
+void
+LatencyHistogram::reset() noexcept
+{
+  for (auto& bucket : m_buckets) {
+    bucket.reset();
+  }
+  m_count.reset();
+  m_sumNs.reset();
+}
+
+} // namespace ndn::util
@@ -0,0 +1,159 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_COUNTERS_HPP
+#define NDN_CXX_UTIL_COUNTERS_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <array>
+#include <atomic>
+
+namespace ndn::util {
+
+/**
+ * @brief A monotonically increasing 64-bit counter.
+ *
+ * The counter is updated by a single writer (usually the thread running the io_context)
+ * and can be read from any thread. All operations use relaxed memory ordering, so they
+ * are cheap enough to be left enabled in production.
+ */
+class Counter : noncopyable
+{
+public:
+  Counter&
+  operator++() noexcept
+  {
+    m_value.fetch_add(1, std::memory_order_relaxed);
+    return *this;
+  }
+
+  Counter&
+  operator+=(uint64_t n) noexcept
+  {
+    m_value.fetch_add(n, std::memory_order_relaxed);
+    return *this;
+  }
+
+  uint64_t
+  get() const noexcept
+  {
+    return m_value.load(std::memory_order_relaxed);
+  }
+
+  operator uint64_t() const noexcept
+  {
+    return get();
+  }
+
+  void
+  reset() noexcept
+  {
+    m_value.store(0, std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<uint64_t> m_value{0};
+};
+
+/**
+ * @brief A histogram of durations with logarithmically spaced buckets.
+ *
+ * Bucket 0 counts samples shorter than 2 microseconds. Bucket `i` (0 < i < N_BUCKETS - 1)
+ * counts samples in the range [2^i, 2^(i+1)) microseconds. The last bucket counts all
+ * samples of 2^(N_BUCKETS-1) microseconds (about 33.5 seconds) or longer.
+ *
+ * Like Counter, the histogram is written by a single thread and can be read from any thread.
+ * A reader may observe a sample in getCount() before it appears in a bucket or vice versa.
+ */
+class LatencyHistogram : noncopyable
+{
+public:
+  static constexpr size_t N_BUCKETS = 26;
+
+  /**
+   * @brief Record a new sample.
+   */
+  void
+  add(time::nanoseconds sample) noexcept;
+
+  /**
+   * @brief Return the total number of samples.
+   */
+  uint64_t
+  getCount() const noexcept
+  {
+    return m_count.get();
+  }
+
+  /**
+   * @brief Return the sum of all samples.
+   */
+  time::nanoseconds
+  getSum() const noexcept
+  {
+    return time::nanoseconds(m_sumNs.get());
+  }
+
+  /**
+   * @brief Return the number of samples in bucket @p i.
+   * @pre i < N_BUCKETS
+   */
+  uint64_t
+  getBucketCount(size_t i) const noexcept
+  {
+    BOOST_ASSERT(i < N_BUCKETS);
+    return m_buckets[i].get();
+  }
+
+  /**
+   * @brief Return the exclusive upper bound of bucket @p i.
+   * @return time::nanoseconds::max() for the last bucket
+   * @pre i < N_BUCKETS
+   */
+  static time::nanoseconds
+  getBucketUpperBound(size_t i) noexcept;
+
+  /**
+   * @brief Return an estimate of the @p q -th quantile, e.g., 0.99 for the 99th percentile.
+   *
+   * The estimate is the upper bound of the bucket containing the quantile,
+   * so it overestimates the true value by at most a factor of two.
+   *
+   * @return zero if no samples have been recorded
+   * @pre 0.0 <= q <= 1.0
+   */
+  time::nanoseconds
+  getQuantile(double q) const noexcept;
+
+  void
+  reset() noexcept;
+
+private:
+  std::array<Counter, N_BUCKETS> m_buckets;
+  Counter m_count;
+  Counter m_sumNs;
+};
+
+} // namespace ndn::util
+
+#endif // NDN_CXX_UTIL_COUNTERS_HPP
@@ -0,0 +1,172 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/fetch-manager.hpp"
+
+#include <algorithm>
+
+namespace ndn {
+
+FetchManager::FetchManager(Face& face, security::Validator& validator, const Options& options)
+  : m_options(options)
+  , m_face(face)
+  , m_validator(validator)
+{
+  m_options.fetcherOptions.validate();
+  if (m_options.maxInFlight == 0) {
+    NDN_THROW(std::invalid_argument("maxInFlight must be greater than 0"));
+  }
+
+  m_scheduler = make_shared<Scheduler>(m_face.getIoContext());
+  m_rttEstimator = make_shared<util::RttEstimator>(
+                     make_shared<util::RttEstimator::Options>(m_options.fetcherOptions.rttOptions));
+  m_cc = SegmentFetcher::makeCongestionControl(m_options.fetcherOptions);
+}
+
+FetchManager::~FetchManager()
+{
+  auto fetchers = std::move(m_fetchers);
+  for (const auto& entry : fetchers) {
+    entry.fetcher->m_manager = nullptr;
+    entry.fetcher->stop();
+  }
+}
+
+shared_ptr<SegmentFetcher>
+FetchManager::fetch(const Interest& baseInterest, int priority)
+{
+  return addFetcher(baseInterest, priority, m_options.fetcherOptions);
+}
+
+shared_ptr<SegmentFetcher>
+FetchManager::addFetcher(const Interest& baseInterest, int priority,
+                         const SegmentFetcher::Options& options)
+{
+  shared_ptr<SegmentFetcher> fetcher(new SegmentFetcher(m_face, m_validator, options, this));
+  fetcher->m_this = fetcher;
+  fetcher->m_baseInterest = baseInterest;
+  m_fetchers.push_back({fetcher, priority, true});
+  scheduleInterests();
+  return fetcher;
+}
+
+shared_ptr<SegmentFetcher>
+FetchManager::fetchDependency(const SegmentFetcher& parent, const Interest& baseInterest,
+                              const SegmentFetcher::Options& options)
+{
+  auto it = std::find_if(m_fetchers.begin(), m_fetchers.end(),
+                         [&] (const auto& entry) { return entry.fetcher.get() == &parent; });
+  int priority = it != m_fetchers.end() ? it->priority : 0;
+  return addFetcher(baseInterest, priority, options);
+}
+
+void
+FetchManager::scheduleInterests()
+{
+  if (m_isScheduling) {
+    // called back by a fetcher while sending an Interest; the outer loop fills the window
+    return;
+  }
+  m_isScheduling = true;
+
+  for (auto& entry : m_fetchers) {
+    entry.canSend = entry.fetcher->canSendManagedInterest();
+  }
+
+  auto windowLimit = static_cast<int64_t>(std::min<double>(m_cc->getCwnd(),
+                                                           m_options.maxInFlight));
+  while (m_nOutstanding < windowLimit) {
+    auto index = pickNext();
+    if (!index) {
+      break;
+    }
+
+    auto fetcher = m_fetchers[*index].fetcher;
+    bool hasSent = fetcher->sendManagedInterest();
+    if (*index < m_fetchers.size() && m_fetchers[*index].fetcher == fetcher) {
+      m_fetchers[*index].canSend = hasSent && fetcher->canSendManagedInterest();
+    }
+  }
+
+  m_isScheduling = false;
+}
+
+std::optional<size_t>
+FetchManager::pickNext()
+{
+  std::optional<size_t> next;
+  for (size_t i = 0; i < m_fetchers.size(); ++i) {
+    size_t index = (m_nextIndex + i) % m_fetchers.size();
+    const auto& entry = m_fetchers[index];
+    if (!entry.canSend) {
+      continue;
+    }
+    if (m_options.scheduling == Scheduling::FAIR) {
+      next = index;
+      break;
+    }
+    // the first entry found at each priority level is the next one in round-robin order
+    if (!next || entry.priority > m_fetchers[*next].priority) {
+      next = index;
+    }
+  }
+
+  if (next) {
+    m_nextIndex = *next + 1;
+  }
+  return next;
+}
+
+void
+FetchManager::afterCongestionEvent(time::steady_clock::time_point sendTime)
+{
+  // react to at most one congestion event per round trip, over all objects
+  if (!m_options.fetcherOptions.disableCwa && sendTime <= m_lastCongestionEvent) {
+    return;
+  }
+
+  m_lastCongestionEvent = time::steady_clock::now();
+  if (!m_options.fetcherOptions.useConstantCwnd) {
+    m_cc->afterCongestionEvent();
+  }
+}
+
+void
+FetchManager::removeFetcher(const SegmentFetcher& fetcher)
+{
+  auto it = std::find_if(m_fetchers.begin(), m_fetchers.end(),
+                         [&] (const auto& entry) { return entry.fetcher.get() == &fetcher; });
+  if (it == m_fetchers.end()) {
+    return;
+  }
+
+  auto index = static_cast<size_t>(std::distance(m_fetchers.begin(), it));
+  m_nOutstanding -= fetcher.getNOutstanding();
+  m_fetchers.erase(it);
+  if (m_nextIndex > index) {
+    --m_nextIndex;
+  }
+
+  // the window freed by the removed fetcher can be used by the others
+  scheduleInterests();
+}
+
+} // namespace ndn
@@ -0,0 +1,208 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_FETCH_MANAGER_HPP
+#define NDN_CXX_UTIL_FETCH_MANAGER_HPP
+
+#include "ndn-cxx/util/segment-fetcher.hpp"
+
+#include <optional>
+#include <vector>
+
+namespace ndn {
+
+/**
+ * \brief Options for FetchManager.
+ */
+struct FetchManagerOptions
+{
+  enum class Scheduling {
+    FAIR,     ///< round-robin among all objects
+    PRIORITY, ///< strict priority, round-robin among objects with the same priority
+  };
+
+  /// Options for the fetchers, including the shared congestion control and RTT estimator
+  SegmentFetcherOptions fetcherOptions;
+  /// Maximum number of Interests in flight and segments awaiting validation, over all objects
+  size_t maxInFlight = 1000;
+  /// How the window is divided among objects
+  Scheduling scheduling = Scheduling::FAIR;
+};
+
+/**
+ * @brief Fetches several segmented objects over a single congestion window.
+ *
+ * Each object is retrieved by a SegmentFetcher, with the same signals and error handling as
+ * a fetcher created by SegmentFetcher::start(). However, instead of each fetcher running its
+ * own congestion control, all fetchers created by the same FetchManager share one congestion
+ * window, one RTT estimator, and one scheduler. This avoids the aggressiveness of N competing
+ * windows when an application retrieves many objects in parallel from the same producers.
+ *
+ * The total number of Interests in flight, plus segments awaiting validation, is limited by
+ * the shared congestion window and by Options::maxInFlight. Whenever there is room in the
+ * window, the next Interest is assigned to one of the fetchers with pending work:
+ * - with Scheduling::FAIR, fetchers take turns in round-robin order;
+ * - with Scheduling::PRIORITY, the fetchers with the highest priority take turns, and fetchers
+ *   with a lower priority send Interests only when no higher-priority fetcher can.
+ *
+ * Conservative window adaptation is applied across all objects: the window is decreased at most
+ * once per round trip, i.e., a loss or congestion mark only counts as a new congestion event if
+ * the Interest that experienced it was sent after the previous window decrease.
+ *
+ * Example:
+ * @code
+ * FetchManager manager(face, validator);
+ * auto fetcher = manager.fetch(Interest("/data/prefix"));
+ * fetcher->onComplete.connect([] (ConstBufferPtr data) {...});
+ * fetcher->onError.connect([] (uint32_t errorCode, const std::string& errorMsg) {...});
+ * @endcode
+ *
+ * @note The FetchManager must outlive the transfers it manages. Destroying it stops all
+ *       transfers that have not completed yet.
+ */
+class FetchManager : noncopyable
+{
+public:
+  using Options = FetchManagerOptions;
+  using Scheduling = FetchManagerOptions::Scheduling;
+
+  /**
+   * @param face      Face used to fetch all objects.
+   * @param validator Validator used to validate all segments. It must remain valid for the
+   *                  lifetime of the FetchManager.
+   * @param options   Options controlling the transfers.
+   * @throw std::invalid_argument @p options are invalid
+   */
+  FetchManager(Face& face, security::Validator& validator, const Options& options = {});
+
+  ~FetchManager();
+
+  /**
+   * @brief Initiates fetching an object within the shared window.
+   *
+   * @param baseInterest Interest for the initial segment of the object,
+   *                     as in SegmentFetcher::start().
+   * @param priority     Priority of the object; higher values are served first.
+   *                     Ignored unless Options::scheduling is Scheduling::PRIORITY.
+   * @return The SegmentFetcher retrieving the object, to which signals can be connected.
+   *         The first Interest may not be sent until there is room in the shared window.
+   */
+  shared_ptr<SegmentFetcher>
+  fetch(const Interest& baseInterest, int priority = 0);
+
+  /**
+   * @brief Returns the number of objects being fetched.
+   */
+  size_t
+  getNFetchers() const
+  {
+    return m_fetchers.size();
+  }
+
+  /**
+   * @brief Returns the number of Interests in flight and segments awaiting validation,
+   *        over all objects.
+   */
+  int64_t
+  getNOutstanding() const
+  {
+    return m_nOutstanding;
+  }
+
+  const util::CongestionControl&
+  getCongestionControl() const
+  {
+    return *m_cc;
+  }
+
+  const util::RttEstimator&
+  getRttEstimator() const
+  {
+    return *m_rttEstimator;
+  }
+
+private:
+  struct FetcherEntry
+  {
+    shared_ptr<SegmentFetcher> fetcher;
+    int priority;
+    /// whether the fetcher may have an Interest to send in the current scheduling round
+    bool canSend;
+  };
+
+  shared_ptr<SegmentFetcher>
+  addFetcher(const Interest& baseInterest, int priority, const SegmentFetcher::Options& options);
+
+  /**
+   * @brief Initiates fetching an object that @p parent needs, e.g., its manifest, with the
+   *        priority of @p parent.
+   */
+  shared_ptr<SegmentFetcher>
+  fetchDependency(const SegmentFetcher& parent, const Interest& baseInterest,
+                  const SegmentFetcher::Options& options);
+
+  /**
+   * @brief Sends Interests for the managed objects while there is room in the shared window.
+   */
+  void
+  scheduleInterests();
+
+  /**
+   * @brief Returns the index of the entry that may send the next Interest, if any.
+   */
+  std::optional<size_t>
+  pickNext();
+
+  /**
+   * @brief Applies conservative window adaptation to a congestion event.
+   * @param sendTime when the Interest that experienced the congestion event was sent
+   */
+  void
+  afterCongestionEvent(time::steady_clock::time_point sendTime);
+
+  /**
+   * @brief Forgets a fetcher that has completed or has been stopped.
+   */
+  void
+  removeFetcher(const SegmentFetcher& fetcher);
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  Options m_options;
+  Face& m_face;
+  security::Validator& m_validator;
+  shared_ptr<Scheduler> m_scheduler;
+  shared_ptr<util::RttEstimator> m_rttEstimator;
+  shared_ptr<util::CongestionControl> m_cc;
+
+  std::vector<FetcherEntry> m_fetchers;
+  /// sum of SegmentFetcher::getNOutstanding() over all managed fetchers
+  int64_t m_nOutstanding = 0;
+  /// index of the entry where the round-robin search for the next Interest starts
+  size_t m_nextIndex = 0;
+  time::steady_clock::time_point m_lastCongestionEvent = time::steady_clock::time_point::min();
+  bool m_isScheduling = false;
+
+  friend SegmentFetcher;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_UTIL_FETCH_MANAGER_HPP
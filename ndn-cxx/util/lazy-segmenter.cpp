@@ -0,0 +1,195 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/lazy-segmenter.hpp"
+#include "ndn-cxx/detail/mapped-file.hpp"
+
+namespace ndn {
+
+LazySegmenter::LazySegmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo,
+                             const Name& dataName, size_t maxSegmentSize,
+                             time::milliseconds freshnessPeriod, uint32_t contentType)
+  : m_keyChain(keyChain)
+  , m_signingInfo(signingInfo)
+  , m_dataName(dataName)
+  , m_maxSegmentSize(maxSegmentSize)
+  , m_freshnessPeriod(freshnessPeriod)
+  , m_contentType(contentType)
+{
+  if (maxSegmentSize == 0) {
+    NDN_THROW(std::invalid_argument("maxSegmentSize must be greater than 0"));
+  }
+  if (freshnessPeriod < 0_ms) {
+    NDN_THROW(std::invalid_argument("FreshnessPeriod cannot be negative"));
+  }
+}
+
+LazySegmenter::LazySegmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo,
+                             std::istream& input, const Name& dataName, size_t maxSegmentSize,
+                             time::milliseconds freshnessPeriod, uint32_t contentType)
+  : LazySegmenter(keyChain, signingInfo, dataName, maxSegmentSize, freshnessPeriod, contentType)
+{
+  m_input = &input;
+  m_begin = input.tellg();
+  input.seekg(0, std::ios::end);
+  auto end = input.tellg();
+  if (m_begin == std::istream::pos_type(-1) || end == std::istream::pos_type(-1) || !input) {
+    NDN_THROW(Error("Input stream is not seekable"));
+  }
+
+  setObjectSize(static_cast<uint64_t>(end - m_begin));
+}
+
+LazySegmenter::LazySegmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo,
+                             const std::string& filename, const Name& dataName,
+                             size_t maxSegmentSize, time::milliseconds freshnessPeriod,
+                             uint32_t contentType)
+  : LazySegmenter(keyChain, signingInfo, dataName, maxSegmentSize, freshnessPeriod, contentType)
+{
+  try {
+    m_file = make_unique<detail::MappedFile>(filename);
+  }
+  catch (const detail::MappedFile::Error& e) {
+    NDN_THROW_NESTED(Error(e.what()));
+  }
+
+  setObjectSize(m_file->getContent().size());
+}
+
+LazySegmenter::~LazySegmenter() = default;
+
+void
+LazySegmenter::setObjectSize(uint64_t objectSize)
+{
+  m_objectSize = objectSize;
+  // minimum of one (possibly empty) segment
+  m_nSegments = 1 + (m_objectSize - (m_objectSize != 0)) / m_maxSegmentSize;
+  m_finalBlockId = name::Component::fromSegment(m_nSegments - 1);
+}
+
+void
+LazySegmenter::setReadAhead(size_t nSegments)
+{
+  m_readAhead = nSegments;
+}
+
+void
+LazySegmenter::setCacheLimit(size_t nSegments)
+{
+  m_cacheLimit = nSegments;
+  evictSegments(std::max(m_cacheLimit, m_readAhead + 1));
+}
+
+void
+LazySegmenter::evictSegments(size_t limit)
+{
+  while (m_cache.size() > limit) {
+    m_cache.erase(m_lru.front());
+    m_lru.pop_front();
+  }
+}
+
+shared_ptr<Data>
+LazySegmenter::getSegment(uint64_t segmentNo)
+{
+  if (segmentNo >= m_nSegments) {
+    return nullptr;
+  }
+
+  auto data = getOrMakeSegment(segmentNo);
+
+  auto last = std::min(segmentNo + m_readAhead, m_nSegments - 1);
+  for (auto i = segmentNo + 1; i <= last; ++i) {
+    getOrMakeSegment(i);
+  }
+
+  return data;
+}
+
+shared_ptr<Data>
+LazySegmenter::find(const Interest& interest)
+{
+  const auto& name = interest.getName();
+  uint64_t segmentNo = 0;
+  if (name.size() == m_dataName.size() + 1 && name[-1].isSegment() &&
+      m_dataName.isPrefixOf(name)) {
+    segmentNo = name[-1].toSegment();
+  }
+  else if (!interest.getCanBePrefix() || !name.isPrefixOf(m_dataName)) {
+    return nullptr;
+  }
+
+  auto data = getSegment(segmentNo);
+  if (data == nullptr || !interest.matchesData(*data)) {
+    return nullptr;
+  }
+  return data;
+}
+
+shared_ptr<Data>
+LazySegmenter::getOrMakeSegment(uint64_t segmentNo)
+{
+  auto it = m_cache.find(segmentNo);
+  if (it != m_cache.end()) {
+    m_lru.splice(m_lru.end(), m_lru, it->second.lruPos);
+    return it->second.data;
+  }
+
+  auto data = makeSegment(segmentNo);
+
+  // a consumer that retransmits an Interest requests a segment again, so evict the least
+  // recently used segments rather than the lowest numbered ones
+  evictSegments(std::max(m_cacheLimit, m_readAhead + 1) - 1);
+  m_cache.emplace(segmentNo, CachedSegment{data, m_lru.insert(m_lru.end(), segmentNo)});
+  return data;
+}
+
+shared_ptr<Data>
+LazySegmenter::makeSegment(uint64_t segmentNo)
+{
+  uint64_t offset = segmentNo * m_maxSegmentSize;
+  auto segLen = static_cast<size_t>(std::min<uint64_t>(m_objectSize - offset, m_maxSegmentSize));
+
+  auto data = std::make_shared<Data>();
+  data->setName(Name(m_dataName).appendSegment(segmentNo));
+  data->setContentType(m_contentType);
+  data->setFreshnessPeriod(m_freshnessPeriod);
+  data->setFinalBlock(m_finalBlockId);
+
+  if (m_file != nullptr) {
+    data->setContent(m_file->getContent().subspan(static_cast<size_t>(offset), segLen));
+  }
+  else {
+    auto buffer = std::make_shared<Buffer>(segLen);
+    m_input->clear();
+    m_input->seekg(m_begin + static_cast<std::streamoff>(offset));
+    m_input->read(buffer->get<char>(), static_cast<std::streamsize>(segLen));
+    if (static_cast<size_t>(m_input->gcount()) != segLen) {
+      NDN_THROW(Error("Cannot read segment " + to_string(segmentNo) + " from input stream"));
+    }
+    data->setContent(std::move(buffer));
+  }
+
+  m_keyChain.sign(*data, m_signingInfo);
+  return data;
+}
+
+} // namespace ndn
@@ -0,0 +1,230 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_LAZY_SEGMENTER_HPP
+#define NDN_CXX_UTIL_LAZY_SEGMENTER_HPP
+
+#include "ndn-cxx/security/key-chain.hpp"
+
+#include <list>
+#include <unordered_map>
+
+namespace ndn {
+
+namespace detail {
+class MappedFile;
+} // namespace detail
+
+/**
+ * @brief Segments an object read from a seekable input stream on demand.
+ *
+ * Unlike Segmenter, which reads the whole input and signs every segment before returning,
+ * LazySegmenter only determines the size of the input when it is constructed. Since the
+ * FinalBlockId is then known in advance, each segment can be read and signed independently,
+ * when it is first requested. Recently produced segments are kept in a small cache, and an
+ * optional read-ahead prepares the segments that a sequential consumer will request next.
+ * Memory use is therefore bounded by the cache size rather than by the size of the object.
+ *
+ * Segments can be served directly from an Interest callback:
+ * @code
+ * std::ifstream file("large-file", std::ios::binary);
+ * LazySegmenter segmenter(keyChain, signingInfo, file, "/prefix/v=1", 8000, 10_s);
+ * face.setInterestFilter("/prefix/v=1", [&] (const auto&, const Interest& interest) {
+ *   if (auto data = segmenter.find(interest); data != nullptr) {
+ *     face.put(*data);
+ *   }
+ * });
+ * @endcode
+ *
+ * @note The input stream or file must remain valid and unchanged for the lifetime of the
+ *       LazySegmenter.
+ */
+class LazySegmenter : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @brief Constructor.
+   * @param keyChain KeyChain instance used for signing the packets.
+   * @param signingInfo How to sign the packets.
+   * @param input Seekable input stream. The object spans from the current position to the end.
+   * @param dataName Name prefix to use for the Data packets. A segment number will be appended to it.
+   * @param maxSegmentSize Maximum size of the `Content` element (payload) of each created Data packet.
+   * @param freshnessPeriod The `FreshnessPeriod` of created Data packets.
+   * @param contentType The `ContentType` of created Data packets.
+   * @throw Error @p input is not seekable
+   * @throw std::invalid_argument @p maxSegmentSize is zero or @p freshnessPeriod is negative
+   */
+  LazySegmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo,
+                std::istream& input,
+                const Name& dataName,
+                size_t maxSegmentSize,
+                time::milliseconds freshnessPeriod,
+                uint32_t contentType = tlv::ContentType_Blob);
+
+  /**
+   * @brief Constructor that memory-maps a file.
+   *
+   * Each segment is read from the mapping when it is requested, without an intermediate read
+   * buffer. Its content is copied into the Data packet, and again into the wire encoding when
+   * the packet is signed. Only the segments in the cache are held in memory.
+   * @param keyChain KeyChain instance used for signing the packets.
+   * @param signingInfo How to sign the packets.
+   * @param filename Path of the file.
+   * @param dataName Name prefix to use for the Data packets. A segment number will be appended to it.
+   * @param maxSegmentSize Maximum size of the `Content` element (payload) of each created Data packet.
+   * @param freshnessPeriod The `FreshnessPeriod` of created Data packets.
+   * @param contentType The `ContentType` of created Data packets.
+   * @throw Error the file cannot be opened or mapped
+   * @throw std::invalid_argument @p maxSegmentSize is zero or @p freshnessPeriod is negative
+   */
+  LazySegmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo,
+                const std::string& filename,
+                const Name& dataName,
+                size_t maxSegmentSize,
+                time::milliseconds freshnessPeriod,
+                uint32_t contentType = tlv::ContentType_Blob);
+
+  ~LazySegmenter();
+
+  const Name&
+  getName() const noexcept
+  {
+    return m_dataName;
+  }
+
+  /**
+   * @brief Returns the size of the object, in octets.
+   */
+  uint64_t
+  getObjectSize() const noexcept
+  {
+    return m_objectSize;
+  }
+
+  /**
+   * @brief Returns the number of segments, which is at least one, even for an empty object.
+   */
+  uint64_t
+  getNSegments() const noexcept
+  {
+    return m_nSegments;
+  }
+
+  /**
+   * @brief Set the number of segments that are signed ahead of the last requested segment.
+   *
+   * The default is zero, i.e., every segment is signed only when requested.
+   */
+  void
+  setReadAhead(size_t nSegments);
+
+  /**
+   * @brief Set the maximum number of signed segments kept in memory.
+   *
+   * When the cache is full, the least recently used segment is evicted. The cache always holds at least the read-ahead window plus the requested segment.
+   * The default is 64.
+   */
+  void
+  setCacheLimit(size_t nSegments);
+
+  /**
+   * @brief Returns the number of signed segments currently kept in memory.
+   */
+  size_t
+  getNCachedSegments() const noexcept
+  {
+    return m_cache.size();
+  }
+
+  /**
+   * @brief Returns the segment with number @p segmentNo, reading and signing it if necessary.
+   * @return the segment, or nullptr if @p segmentNo is past the last segment
+   * @throw Error the input could not be read
+   */
+  shared_ptr<Data>
+  getSegment(uint64_t segmentNo);
+
+  /**
+   * @brief Returns the segment that satisfies @p interest, if any.
+   *
+   * An Interest for the name prefix of the object with CanBePrefix, such as the first Interest
+   * of SegmentFetcher, is answered with segment zero.
+   * @throw Error the input could not be read
+   */
+  shared_ptr<Data>
+  find(const Interest& interest);
+
+private:
+  LazySegmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo,
+                const Name& dataName, size_t maxSegmentSize,
+                time::milliseconds freshnessPeriod, uint32_t contentType);
+
+  void
+  setObjectSize(uint64_t objectSize);
+
+  shared_ptr<Data>
+  makeSegment(uint64_t segmentNo);
+
+  shared_ptr<Data>
+  getOrMakeSegment(uint64_t segmentNo);
+
+  void
+  evictSegments(size_t limit);
+
+private:
+  KeyChain& m_keyChain;
+  const security::SigningInfo m_signingInfo;
+  const Name m_dataName;
+  const size_t m_maxSegmentSize;
+  const time::milliseconds m_freshnessPeriod;
+  const uint32_t m_contentType;
+
+  // the input is either a stream or a memory-mapped file
+  std::istream* m_input = nullptr;
+  std::istream::pos_type m_begin;
+  unique_ptr<detail::MappedFile> m_file;
+
+  uint64_t m_objectSize = 0;
+  uint64_t m_nSegments = 0;
+  name::Component m_finalBlockId;
+
+  size_t m_readAhead = 0;
+  size_t m_cacheLimit = 64;
+
+  struct CachedSegment
+  {
+    shared_ptr<Data> data;
+    std::list<uint64_t>::iterator lruPos;
+  };
+  std::unordered_map<uint64_t, CachedSegment> m_cache;
+  /// numbers of the cached segments, least recently used first
+  std::list<uint64_t> m_lru;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_UTIL_LAZY_SEGMENTER_HPP
@@ -0,0 +1,278 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/packet-tracer.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <mutex>
+#include <ostream>
+
+namespace ndn::util {
+
+std::ostream&
+operator<<(std::ostream& os, PacketTraceEvent event)
+{
+  switch (event) {
+    case PacketTraceEvent::NONE:
+      return os << "none";
+    case PacketTraceEvent::IN_INTEREST:
+      return os << ">I";
+    case PacketTraceEvent::IN_DATA:
+      return os << ">D";
+    case PacketTraceEvent::IN_NACK:
+      return os << ">N";
+    case PacketTraceEvent::OUT_INTEREST:
+      return os << "<I";
+    case PacketTraceEvent::OUT_DATA:
+      return os << "<D";
+    case PacketTraceEvent::OUT_NACK:
+      return os << "<N";
+    case PacketTraceEvent::SATISFIED:
+      return os << "satisfied";
+    case PacketTraceEvent::NACKED:
+      return os << "nacked";
+    case PacketTraceEvent::TIMED_OUT:
+      return os << "timeout";
+    case PacketTraceEvent::TRANSPORT_SEND:
+      return os << "tx";
+    case PacketTraceEvent::TRANSPORT_RECV:
+      return os << "rx";
+  }
+  return os << "unknown(" << static_cast<unsigned>(event) << ')';
+}
+
+namespace {
+
+/**
+ * \brief Single-producer ring buffer of trace records.
+ *
+ * Only the owning thread calls push(); any thread may call copyTo() while holding the
+ * registry mutex. Each slot is guarded by a sequence number, which is odd while the slot is
+ * being written and otherwise identifies the record it holds, so that copyTo() skips the
+ * records that are overwritten while they are being copied instead of returning torn ones.
+ */
+class TraceRing : noncopyable
+{
+public:
+  TraceRing(size_t capacity, uint16_t thread)
+    : m_slots(capacity)
+    , m_mask(capacity - 1)
+    , m_thread(thread)
+  {
+  }
+
+  void
+  push(PacketTraceRecord record) noexcept
+  {
+    record.thread = m_thread;
+    uint64_t words[N_WORDS];
+    std::memcpy(words, &record, sizeof(record));
+
+    auto head = m_head.load(std::memory_order_relaxed);
+    auto& slot = m_slots[head & m_mask];
+    slot.seq.store(2 * head + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < N_WORDS; ++i) {
+      slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    slot.seq.store(2 * head + 2, std::memory_order_release);
+    m_head.store(head + 1, std::memory_order_release);
+  }
+
+  void
+  copyTo(std::vector<PacketTraceRecord>& out) const
+  {
+    auto head = m_head.load(std::memory_order_acquire);
+    auto n = std::min<uint64_t>(head, m_slots.size());
+    for (auto i = head - n; i != head; ++i) {
+      const auto& slot = m_slots[i & m_mask];
+      if (slot.seq.load(std::memory_order_acquire) != 2 * i + 2) {
+        continue; // already being overwritten
+      }
+      uint64_t words[N_WORDS];
+      for (size_t j = 0; j < N_WORDS; ++j) {
+        words[j] = slot.words[j].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) != 2 * i + 2) {
+        continue; // overwritten while being copied
+      }
+      PacketTraceRecord record;
+      std::memcpy(&record, words, sizeof(record));
+      out.push_back(record);
+    }
+  }
+
+private:
+  static constexpr size_t N_WORDS = sizeof(PacketTraceRecord) / sizeof(uint64_t);
+  static_assert(sizeof(PacketTraceRecord) % sizeof(uint64_t) == 0);
+
+  struct Slot
+  {
+    std::atomic<uint64_t> seq{0};
+    std::atomic<uint64_t> words[N_WORDS] = {};
+  };
+
+  std::vector<Slot> m_slots;
+  const size_t m_mask;
+  const uint16_t m_thread;
+  std::atomic<uint64_t> m_head{0};
+};
+
+struct TraceRegistry
+{
+  std::mutex mutex;
+  std::vector<shared_ptr<TraceRing>> rings;
+  size_t capacity = 0;
+  std::atomic<uint64_t> generation{0};
+};
+
+TraceRegistry&
+getRegistry()
+{
+  static TraceRegistry registry;
+  return registry;
+}
+
+// rings are co-owned by the registry, so that events survive the exit of the recording thread
+thread_local shared_ptr<TraceRing> t_ring;
+thread_local uint64_t t_ringGeneration = 0;
+
+constexpr char MAGIC[8] = {'N', 'D', 'N', 'T', 'R', 'A', 'C', 'E'};
+constexpr uint32_t FORMAT_VERSION = 1;
+
+struct FileHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t recordSize;
+  uint64_t nRecords;
+};
+
+static_assert(sizeof(FileHeader) == 24);
+
+} // namespace
+
+void
+PacketTracer::enable(size_t capacity)
+{
+  size_t roundedCapacity = 2;
+  while (roundedCapacity < capacity) {
+    roundedCapacity <<= 1;
+  }
+
+  auto& registry = getRegistry();
+  std::lock_guard lock(registry.mutex);
+  registry.rings.clear();
+  registry.capacity = roundedCapacity;
+  registry.generation.fetch_add(1, std::memory_order_release);
+  s_isEnabled.store(true, std::memory_order_relaxed);
+}
+
+void
+PacketTracer::disable() noexcept
+{
+  s_isEnabled.store(false, std::memory_order_relaxed);
+}
+
+void
+PacketTracer::doRecord(PacketTraceEvent event, uint64_t nameHash, size_t size, uint64_t pitId)
+{
+  auto& registry = getRegistry();
+  if (t_ring == nullptr ||
+      t_ringGeneration != registry.generation.load(std::memory_order_acquire)) {
+    // slow path: first event on this thread since tracing was (re)enabled
+    std::lock_guard lock(registry.mutex);
+    t_ring = make_shared<TraceRing>(registry.capacity, static_cast<uint16_t>(registry.rings.size()));
+    t_ringGeneration = registry.generation.load(std::memory_order_relaxed);
+    registry.rings.push_back(t_ring);
+  }
+
+  PacketTraceRecord record{};
+  record.timestamp = static_cast<uint64_t>(time::steady_clock::now().time_since_epoch().count());
+  record.nameHash = nameHash;
+  record.pitId = pitId;
+  record.size = static_cast<uint32_t>(size);
+  record.event = event;
+  t_ring->push(record);
+}
+
+std::vector<PacketTraceRecord>
+PacketTracer::snapshot()
+{
+  std::vector<PacketTraceRecord> records;
+  {
+    auto& registry = getRegistry();
+    std::lock_guard lock(registry.mutex);
+    for (const auto& ring : registry.rings) {
+      ring->copyTo(records);
+    }
+  }
+
+  std::stable_sort(records.begin(), records.end(), [] (const auto& a, const auto& b) {
+    return a.timestamp < b.timestamp;
+  });
+  return records;
+}
+
+void
+PacketTracer::dump(std::ostream& os)
+{
+  auto records = snapshot();
+
+  FileHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = FORMAT_VERSION;
+  header.recordSize = sizeof(PacketTraceRecord);
+  header.nRecords = records.size();
+
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  os.write(reinterpret_cast<const char*>(records.data()),
+           static_cast<std::streamsize>(records.size() * sizeof(PacketTraceRecord)));
+}
+
+std::vector<PacketTraceRecord>
+PacketTracer::load(std::istream& is)
+{
+  FileHeader header{};
+  if (!is.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+      std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    NDN_THROW(Error("Not a packet trace file"));
+  }
+  if (header.version != FORMAT_VERSION || header.recordSize != sizeof(PacketTraceRecord)) {
+    NDN_THROW(Error("Unsupported packet trace format version " + to_string(header.version)));
+  }
+
+  std::vector<PacketTraceRecord> records;
+  PacketTraceRecord record;
+  for (uint64_t i = 0; i < header.nRecords; ++i) {
+    if (!is.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+      NDN_THROW(Error("Truncated packet trace file"));
+    }
+    records.push_back(record);
+  }
+  return records;
+}
+
+} // namespace ndn::util
@@ -0,0 +1,163 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_PACKET_TRACER_HPP
+#define NDN_CXX_UTIL_PACKET_TRACER_HPP
+
+#include "ndn-cxx/name.hpp"
+
+#include <atomic>
+#include <vector>
+
+namespace ndn::util {
+
+/**
+ * \brief Kind of a packet trace event.
+ */
+enum class PacketTraceEvent : uint8_t {
+  NONE           = 0,
+  IN_INTEREST    = 1,  ///< Face received an Interest from the forwarder
+  IN_DATA        = 2,  ///< Face received a Data from the forwarder
+  IN_NACK        = 3,  ///< Face received a Nack from the forwarder
+  OUT_INTEREST   = 4,  ///< Face sent an Interest expressed by the app
+  OUT_DATA       = 5,  ///< Face sent a Data to the forwarder
+  OUT_NACK       = 6,  ///< Face sent a Nack to the forwarder
+  SATISFIED      = 7,  ///< pending Interest expressed by the app was satisfied
+  NACKED         = 8,  ///< pending Interest expressed by the app was Nacked
+  TIMED_OUT      = 9,  ///< pending Interest expressed by the app timed out
+  TRANSPORT_SEND = 10, ///< Transport enqueued a TLV block for transmission
+  TRANSPORT_RECV = 11, ///< Transport received a TLV block
+};
+
+std::ostream&
+operator<<(std::ostream& os, PacketTraceEvent event);
+
+/**
+ * \brief Compact binary record of a packet trace event.
+ *
+ * Records are stored in host byte order.
+ */
+struct PacketTraceRecord
+{
+  uint64_t timestamp; ///< nanoseconds since the epoch of time::steady_clock
+  uint64_t nameHash;  ///< `std::hash<Name>` of the packet name, or zero for transport events
+  uint64_t pitId;     ///< pending Interest ID, or zero if the event is not associated with one
+  uint32_t size;      ///< wire encoding size, or zero if not applicable
+  uint16_t thread;    ///< index of the recording thread, in order of first use
+  PacketTraceEvent event;
+  uint8_t reserved;
+};
+
+static_assert(sizeof(PacketTraceRecord) == 32);
+static_assert(std::is_trivially_copyable_v<PacketTraceRecord>);
+
+/**
+ * \brief Low-overhead recorder of packet events.
+ *
+ * When enabled, each thread records events into its own fixed-size ring buffer without any
+ * locking or formatting, so the tracer can be left on under load. Older events are overwritten
+ * when a ring is full. The rings can be collected at any time with snapshot() or dump(), and
+ * a file written by dump() can be decoded offline with the `ndn-trace-dump` tool.
+ *
+ * \note Public static methods are thread safe. A snapshot taken while other threads are
+ *       recording omits the few records that are overwritten while it is being taken, but
+ *       never contains a partially overwritten record.
+ */
+class PacketTracer : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * \brief Enable tracing, discarding all previously recorded events.
+   * \param capacity maximum number of events retained per thread; rounded up to a power of two
+   */
+  static void
+  enable(size_t capacity = 65536);
+
+  /**
+   * \brief Stop recording new events. Already recorded events are retained.
+   */
+  static void
+  disable() noexcept;
+
+  static bool
+  isEnabled() noexcept
+  {
+    return s_isEnabled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Record an event about a network packet.
+   */
+  static void
+  record(PacketTraceEvent event, const Name& name, size_t size, uint64_t pitId = 0)
+  {
+    if (isEnabled()) {
+      doRecord(event, std::hash<Name>{}(name), size, pitId);
+    }
+  }
+
+  /**
+   * \brief Record an event that is not associated with a packet name.
+   */
+  static void
+  record(PacketTraceEvent event, size_t size)
+  {
+    if (isEnabled()) {
+      doRecord(event, 0, size, 0);
+    }
+  }
+
+  /**
+   * \brief Collect the events recorded by all threads, ordered by timestamp.
+   */
+  [[nodiscard]] static std::vector<PacketTraceRecord>
+  snapshot();
+
+  /**
+   * \brief Write a snapshot of recorded events to \p os in binary format.
+   */
+  static void
+  dump(std::ostream& os);
+
+  /**
+   * \brief Decode events written by dump().
+   * \throw Error the input is not a valid packet trace
+   */
+  [[nodiscard]] static std::vector<PacketTraceRecord>
+  load(std::istream& is);
+
+private:
+  static void
+  doRecord(PacketTraceEvent event, uint64_t nameHash, size_t size, uint64_t pitId);
+
+private:
+  static inline std::atomic<bool> s_isEnabled{false};
+};
+
+} // namespace ndn::util
+
+#endif // NDN_CXX_UTIL_PACKET_TRACER_HPP
@@ -23,52 +23,180 @@
 #include "ndn-cxx/util/impl/steady-timer.hpp"
 #include "ndn-cxx/util/scope.hpp"
 
+#include <boost/intrusive/set.hpp>
+
+#include <algorithm>
+
 namespace ndn::scheduler {
 
+namespace bi = boost::intrusive;
+
 /**
  * \brief Stores internal information about a scheduled event.
+ *
+ * EventInfo nodes are owned by the pool of a Scheduler and are recycled after the event
+ * expires or is canceled. Recycling advances the generation, invalidating all EventIds
+ * that refer to the previous use of the node.
  */
 struct EventInfo : noncopyable
 {
-  EventInfo(time::nanoseconds after, EventCallback&& cb)
-    : expiry(time::steady_clock::now() + after)
-    , callback(std::move(cb))
+  bi::set_member_hook<bi::link_mode<bi::normal_link>> queueHook;
+  time::steady_clock::time_point expiry;
+  detail::UniqueFunction<void()> callback;
+  Scheduler* scheduler = nullptr;
+  EventInfo* nextFree = nullptr;
+  uint64_t generation = 0;
+};
+
+/**
+ * \brief Pending events ordered by expiry, and the pool of unused event nodes.
+ */
+class EventQueue : noncopyable
+{
+private:
+  struct Compare
+  {
+    bool
+    operator()(const EventInfo& a, const EventInfo& b) const noexcept
+    {
+      return a.expiry < b.expiry;
+    }
+  };
+
+  using Queue = bi::multiset<EventInfo,
+                             bi::member_hook<EventInfo, decltype(EventInfo::queueHook),
+                                             &EventInfo::queueHook>,
+                             bi::compare<Compare>,
+                             bi::constant_time_size<false>>;
+
+public:
+  using iterator = Queue::iterator;
+
+  explicit
+  EventQueue(Scheduler& scheduler) noexcept
+    : m_scheduler(scheduler)
   {
   }
 
-  time::steady_clock::time_point expiry;
-  EventCallback callback;
-  Scheduler::EventQueue::const_iterator queueIt;
-  bool isExpired = false;
+  ~EventQueue()
+  {
+    clear();
+  }
+
+  bool
+  empty() const noexcept
+  {
+    return m_queue.empty();
+  }
+
+  EventInfo&
+  front() noexcept
+  {
+    return *m_queue.begin();
+  }
+
+  EventInfo&
+  insert(time::nanoseconds after, detail::UniqueFunction<void()>&& callback)
+  {
+    EventInfo& info = acquire();
+    info.expiry = time::steady_clock::now() + after;
+    info.callback = std::move(callback);
+    m_queue.insert(info);
+    return info;
+  }
+
+  /**
+   * \brief Remove \p info from the queue and return it to the pool.
+   * \return the callback of the removed event, so that the caller can invoke it or
+   *         choose when to destroy it
+   */
+  detail::UniqueFunction<void()>
+  remove(EventInfo& info) noexcept
+  {
+    m_queue.erase(m_queue.iterator_to(info));
+    ++info.generation;
+    detail::UniqueFunction<void()> callback = std::move(info.callback);
+    info.nextFree = std::exchange(m_freeList, &info);
+    return callback;
+  }
+
+  void
+  clear() noexcept
+  {
+    // callbacks are destroyed one at a time after their node has been recycled,
+    // so that a callback destructor may safely cancel other events
+    while (!m_queue.empty()) {
+      remove(front());
+    }
+  }
+
+private:
+  EventInfo&
+  acquire()
+  {
+    if (m_freeList == nullptr) {
+      grow();
+    }
+    EventInfo& info = *std::exchange(m_freeList, m_freeList->nextFree);
+    info.nextFree = nullptr;
+    return info;
+  }
+
+  void
+  grow()
+  {
+    // chunk size doubles with the pool size, which bounds the number of allocations
+    // to O(log n) for a peak of n pending events
+    size_t chunkSize = std::clamp<size_t>(m_poolSize, MIN_CHUNK_SIZE, MAX_CHUNK_SIZE);
+    auto& chunk = m_chunks.emplace_back(make_unique<EventInfo[]>(chunkSize));
+    for (size_t i = chunkSize; i > 0; --i) {
+      EventInfo& info = chunk[i - 1];
+      info.scheduler = &m_scheduler;
+      info.nextFree = std::exchange(m_freeList, &info);
+    }
+    m_poolSize += chunkSize;
+  }
+
+private:
+  static constexpr size_t MIN_CHUNK_SIZE = 16;
+  static constexpr size_t MAX_CHUNK_SIZE = 4096;
+
+  Scheduler& m_scheduler;
+  Queue m_queue;
+  std::vector<unique_ptr<EventInfo[]>> m_chunks;
+  EventInfo* m_freeList = nullptr;
+  size_t m_poolSize = 0;
 };
 
-EventId::EventId(Scheduler& sched, weak_ptr<EventInfo> info)
-  : CancelHandle([&sched, info] { sched.cancelImpl(info.lock()); })
-  , m_info(std::move(info))
+EventId::EventId(const shared_ptr<EventQueue>& queue, EventInfo& info) noexcept
+  : m_queue(queue)
+  , m_info(&info)
+  , m_generation(info.generation)
 {
 }
 
 EventId::operator bool() const noexcept
 {
-  auto sp = m_info.lock();
-  return sp != nullptr && !sp->isExpired;
+  return !m_queue.expired() && m_info->generation == m_generation;
 }
 
 void
-EventId::reset() noexcept
+EventId::cancel() const
 {
-  *this = {};
+  if (*this) {
+    m_info->scheduler->cancelImpl(*m_info);
+  }
 }
 
-bool
-Scheduler::EventQueueCompare::operator()(const shared_ptr<EventInfo>& a,
-                                         const shared_ptr<EventInfo>& b) const noexcept
+void
+EventId::reset() noexcept
 {
-  return a->expiry < b->expiry;
+  *this = {};
 }
 
 Scheduler::Scheduler(boost::asio::io_context& ioCtx)
-  : m_timer(make_unique<detail::SteadyTimer>(ioCtx))
+  : m_queue(make_shared<EventQueue>(*this))
+  , m_timer(make_unique<detail::SteadyTimer>(ioCtx))
 {
 }
 
@@ -76,31 +204,35 @@ Scheduler::~Scheduler() = default;
 
 EventId
 Scheduler::schedule(time::nanoseconds after, EventCallback callback)
+{
+  return scheduleImpl(after, std::move(callback));
+}
+
+EventId
+Scheduler::scheduleImpl(time::nanoseconds after, detail::UniqueFunction<void()> callback)
 {
   BOOST_ASSERT(callback != nullptr);
 
-  auto i = m_queue.insert(std::make_shared<EventInfo>(after, std::move(callback)));
-  (*i)->queueIt = i;
+  EventInfo& info = m_queue->insert(after, std::move(callback));
 
-  if (!m_isEventExecuting && i == m_queue.begin()) {
+  if (!m_isEventExecuting && &info == &m_queue->front()) {
     // the new event is the first one to expire
     scheduleNext();
   }
 
-  return EventId(*this, *i);
+  return EventId(m_queue, info);
 }
 
 void
-Scheduler::cancelImpl(const shared_ptr<EventInfo>& info)
+Scheduler::cancelImpl(EventInfo& info)
 {
-  if (info == nullptr || info->isExpired) {
-    return;
-  }
-
-  if (info->queueIt == m_queue.begin()) {
+  if (&info == &m_queue->front() && m_timerSlack == 0_ns) {
+    // with a timer slack, the timer is left armed if it also covers the next event
     m_timer->cancel();
+    m_isTimerArmed = false;
   }
-  m_queue.erase(info->queueIt);
+  // the callback is destroyed only after the queue is consistent again
+  auto callback = m_queue->remove(info);
 
   if (!m_isEventExecuting) {
     scheduleNext();
@@ -110,17 +242,37 @@ Scheduler::cancelImpl(const shared_ptr<EventInfo>& info)
 void
 Scheduler::cancelAllEvents()
 {
-  m_queue.clear();
+  m_queue->clear();
   m_timer->cancel();
+  m_isTimerArmed = false;
+}
+
+void
+Scheduler::setTimerSlack(time::nanoseconds slack)
+{
+  if (slack < 0_ns) {
+    NDN_THROW(std::invalid_argument("Timer slack cannot be negative"));
+  }
+  m_timerSlack = slack;
 }
 
 void
 Scheduler::scheduleNext()
 {
-  if (!m_queue.empty()) {
-    m_timer->expires_at((*m_queue.begin())->expiry);
-    m_timer->async_wait([this] (const auto& error) { executeEvent(error); });
+  if (m_queue->empty()) {
+    return;
   }
+
+  auto expiry = m_queue->front().expiry;
+  if (m_isTimerArmed && m_timerDeadline >= expiry && m_timerDeadline - expiry <= m_timerSlack) {
+    // the pending wake-up is within the slack of the earliest event
+    return;
+  }
+
+  m_timerDeadline = expiry + m_timerSlack;
+  m_isTimerArmed = true;
+  m_timer->expires_at(m_timerDeadline);
+  m_timer->async_wait([this] (const auto& error) { executeEvent(error); });
 }
 
 void
@@ -129,6 +281,7 @@ Scheduler::executeEvent(const boost::system::error_code& error)
   if (error) { // e.g., cancelled
     return;
   }
+  m_isTimerArmed = false;
 
   auto guard = make_scope_exit([this] {
     m_isEventExecuting = false;
@@ -138,16 +291,16 @@ Scheduler::executeEvent(const boost::system::error_code& error)
 
   // process all expired events
   auto now = time::steady_clock::now();
-  while (!m_queue.empty()) {
-    auto head = m_queue.begin();
-    shared_ptr<EventInfo> info = *head;
-    if (info->expiry > now) {
+  while (!m_queue->empty()) {
+    EventInfo& info = m_queue->front();
+    if (info.expiry > now) {
       break;
     }
 
-    m_queue.erase(head);
-    info->isExpired = true;
-    info->callback();
+    // the node is recycled before the callback runs, so the EventId is already
+    // "expired" during callback execution
+    auto callback = m_queue->remove(info);
+    callback();
   }
 }
 
@@ -25,13 +25,12 @@
 #include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/detail/cancel-handle.hpp"
 #include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/detail/unique-function.hpp"
 #include "ndn-cxx/util/time.hpp"
 
 #include <boost/operators.hpp>
 #include <boost/system/error_code.hpp>
 
-#include <set>
-
 namespace ndn {
 
 namespace detail {
@@ -41,6 +40,7 @@ class SteadyTimer;
 namespace scheduler {
 
 class Scheduler;
+class EventQueue;
 struct EventInfo;
 
 /** \brief Function to be invoked when a scheduled event expires
@@ -54,11 +54,16 @@ using EventCallback = std::function<void()>;
  *  eid.cancel(); // cancel the event
  *  \endcode
  *
+ *  An EventId refers to a node in the scheduler's pool of events together with the generation
+ *  of that node at the time the event was scheduled. The node's generation is advanced when the
+ *  event expires or is canceled, so a stale EventId never refers to a later event that reuses
+ *  the same node. Copying an EventId involves no allocation.
+ *
  *  \note Canceling an expired (executed) or canceled event has no effect.
- *  \warning Canceling an event after the scheduler has been destructed may trigger undefined
- *           behavior.
+ *  \note After the scheduler has been destructed, the EventId tests as false, and canceling it
+ *        has no effect.
  */
-class EventId : public detail::CancelHandle, private boost::equality_comparable<EventId>
+class EventId : private boost::equality_comparable<EventId>
 {
 public:
   /**
@@ -74,6 +79,14 @@ public:
   explicit
   operator bool() const noexcept;
 
+  /**
+   * \brief Cancel the associated event.
+   *
+   * Has no effect if this EventId is empty, or the event is expired or cancelled.
+   */
+  void
+  cancel() const;
+
   /**
    * \brief Clear this EventId without canceling the associated event.
    * \post !(*this)
@@ -82,7 +95,7 @@ public:
   reset() noexcept;
 
 private:
-  EventId(Scheduler& sched, weak_ptr<EventInfo> info);
+  EventId(const shared_ptr<EventQueue>& queue, EventInfo& info) noexcept;
 
 private: // non-member operators
   // NOTE: the following "hidden friend" operators are available via
@@ -97,18 +110,20 @@ private: // non-member operators
   operator==(const EventId& lhs, const EventId& rhs) noexcept
   {
     return (!lhs && !rhs) ||
-        (!lhs.m_info.owner_before(rhs.m_info) &&
-         !rhs.m_info.owner_before(lhs.m_info));
+        (lhs.m_info == rhs.m_info && lhs.m_generation == rhs.m_generation);
   }
 
   friend std::ostream&
   operator<<(std::ostream& os, const EventId& eventId)
   {
-    return os << eventId.m_info.lock();
+    return os << static_cast<const void*>(eventId ? eventId.m_info : nullptr);
   }
 
 private:
-  weak_ptr<EventInfo> m_info;
+  /// the pool that owns m_info, which is destructed together with the scheduler
+  weak_ptr<EventQueue> m_queue;
+  EventInfo* m_info = nullptr;
+  uint64_t m_generation = 0;
 
   friend Scheduler;
 };
@@ -126,13 +141,22 @@ private:
  *  \endcode
  *
  *  \note Canceling an expired (executed) or canceled event has no effect.
- *  \warning Canceling an event after the scheduler has been destructed may trigger undefined
- *           behavior.
  */
 using ScopedEventId = detail::ScopedCancelHandle<EventId>;
 
 /**
  * \brief Generic time-based event scheduler.
+ *
+ * Events are stored in nodes taken from a per-scheduler free list, which grows on demand and is
+ * never shrunk. Once the pool is large enough for the peak number of pending events, scheduling
+ * and canceling events performs no heap allocation, provided that the callback is passed to the
+ * templated overload of schedule() and fits in its inline storage.
+ *
+ * By default, the internal timer is re-armed for the exact expiry of the earliest event.
+ * Optionally, a timer slack can be set with setTimerSlack(), allowing each event to be delayed
+ * by up to the slack, so that events expiring close to each other are executed from a single
+ * timer wake-up. Events are never executed before their expiry, and are always executed in
+ * order of expiry.
  */
 class Scheduler : noncopyable
 {
@@ -149,15 +173,53 @@ public:
   EventId
   schedule(time::nanoseconds after, EventCallback callback);
 
+  /**
+   * \brief Schedule a one-time event after the specified delay.
+   *
+   * Same as the overload taking EventCallback, except that \p callback is not converted to
+   * `std::function`. It may be move-only, and callables with up to 48 octets of captures are
+   * stored without heap allocation.
+   */
+  template<typename F,
+           typename = std::enable_if_t<std::is_constructible_v<detail::UniqueFunction<void()>, F>>>
+  EventId
+  schedule(time::nanoseconds after, F&& callback)
+  {
+    return scheduleImpl(after, detail::UniqueFunction<void()>(std::forward<F>(callback)));
+  }
+
   /**
    * \brief Cancel all scheduled events.
    */
   void
   cancelAllEvents();
 
+  time::nanoseconds
+  getTimerSlack() const noexcept
+  {
+    return m_timerSlack;
+  }
+
+  /**
+   * \brief Set the maximum delay that may be added to the expiry of each event.
+   *
+   * With a non-zero slack, all events that expire within \p slack of the earliest pending event
+   * are executed together when the timer fires, which reduces the number of timer wake-ups when
+   * many events are scheduled, e.g., Interest timeouts under heavy load.
+   * The new value takes effect the next time the internal timer is armed.
+   *
+   * \param slack timer slack; zero (the default) disables coalescing
+   * \throw std::invalid_argument \p slack is negative
+   */
+  void
+  setTimerSlack(time::nanoseconds slack);
+
 private:
+  EventId
+  scheduleImpl(time::nanoseconds after, detail::UniqueFunction<void()> callback);
+
   void
-  cancelImpl(const shared_ptr<EventInfo>& info);
+  cancelImpl(EventInfo& info);
 
   /** \brief Schedule the next event on the internal timer
    */
@@ -173,21 +235,15 @@ private:
   executeEvent(const boost::system::error_code& code);
 
 private:
-  class EventQueueCompare
-  {
-  public:
-    bool
-    operator()(const shared_ptr<EventInfo>& a, const shared_ptr<EventInfo>& b) const noexcept;
-  };
-
-  using EventQueue = std::multiset<shared_ptr<EventInfo>, EventQueueCompare>;
-  EventQueue m_queue;
+  shared_ptr<EventQueue> m_queue;
 
   unique_ptr<detail::SteadyTimer> m_timer;
+  time::steady_clock::time_point m_timerDeadline;
+  time::nanoseconds m_timerSlack = 0_ns;
+  bool m_isTimerArmed = false;
   bool m_isEventExecuting = false;
 
   friend EventId;
-  friend EventInfo;
 };
 
 } // namespace scheduler
@@ -22,10 +22,12 @@
  */
 
 #include "ndn-cxx/util/segment-fetcher.hpp"
+#include "ndn-cxx/util/fetch-manager.hpp"
 #include "ndn-cxx/name-component.hpp"
-#include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/lp/nack-header.hpp"
+#include "ndn-cxx/util/segmenter.hpp"
+#include "ndn-cxx/util/sha256.hpp"
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/post.hpp>
@@ -33,7 +35,6 @@
 #include <boost/range/adaptor/map.hpp>
 
 #include <algorithm>
-#include <cmath>
 
 namespace ndn {
 
@@ -59,17 +60,42 @@ SegmentFetcher::Options::validate()
 
 SegmentFetcher::SegmentFetcher(Face& face,
                                security::Validator& validator,
-                               const SegmentFetcher::Options& options)
+                               const SegmentFetcher::Options& options,
+                               FetchManager* manager)
   : m_options(options)
   , m_face(face)
-  , m_scheduler(m_face.getIoContext())
   , m_validator(validator)
-  , m_rttEstimator(make_shared<util::RttEstimator::Options>(options.rttOptions))
+  , m_manager(manager)
   , m_timeLastSegmentReceived(time::steady_clock::now())
-  , m_cwnd(options.initCwnd)
-  , m_ssthresh(options.initSsthresh)
 {
   m_options.validate();
+
+  if (m_manager != nullptr) {
+    m_scheduler = m_manager->m_scheduler;
+    m_rttEstimator = m_manager->m_rttEstimator;
+    m_cc = m_manager->m_cc;
+  }
+  else {
+    m_scheduler = make_shared<Scheduler>(m_face.getIoContext());
+    m_rttEstimator = make_shared<util::RttEstimator>(
+                       make_shared<util::RttEstimator::Options>(m_options.rttOptions));
+    m_cc = makeCongestionControl(m_options);
+  }
+}
+
+unique_ptr<util::CongestionControl>
+SegmentFetcher::makeCongestionControl(const Options& options)
+{
+  util::CongestionControl::Options ccOptions;
+  ccOptions.initCwnd = options.initCwnd;
+  ccOptions.initSsthresh = options.initSsthresh;
+  ccOptions.aiStep = options.aiStep;
+  ccOptions.mdCoef = options.mdCoef;
+  ccOptions.resetCwndToInit = options.resetCwndToInit;
+  if (options.makeCongestionControl) {
+    return options.makeCongestionControl(ccOptions);
+  }
+  return util::makeCongestionControl(options.congestionControl, ccOptions);
 }
 
 shared_ptr<SegmentFetcher>
@@ -80,6 +106,7 @@ SegmentFetcher::start(Face& face,
 {
   shared_ptr<SegmentFetcher> fetcher(new SegmentFetcher(face, validator, options));
   fetcher->m_this = fetcher;
+  fetcher->m_baseInterest = baseInterest;
   fetcher->fetchFirstSegment(baseInterest, false);
   return fetcher;
 }
@@ -92,6 +119,12 @@ SegmentFetcher::stop()
   }
 
   m_pendingSegments.clear(); // cancels pending Interests and timeout events
+  if (m_manifestFetcher != nullptr) {
+    m_manifestFetcher->stop();
+  }
+  if (m_manager != nullptr) {
+    std::exchange(m_manager, nullptr)->removeFetcher(*this);
+  }
   boost::asio::post(m_face.getIoContext(), [self = std::move(m_this)] {});
 }
 
@@ -118,6 +151,7 @@ SegmentFetcher::fetchFirstSegment(const Interest& baseInterest, bool isRetransmi
     interest.refreshNonce();
   }
 
+  m_hasSentFirstInterest = true;
   sendInterest(0, interest, isRetransmission);
 }
 
@@ -129,39 +163,65 @@ SegmentFetcher::fetchSegmentsInWindow(const Interest& origInterest)
     return finalizeFetch();
   }
 
+  if (m_manager != nullptr) {
+    // the manager lets each object send Interests in turn, within the shared window
+    return m_manager->scheduleInterests();
+  }
+
+  fetchSegments(origInterest, getAvailableWindowSize(static_cast<int64_t>(m_cc->getCwnd())));
+}
+
+int64_t
+SegmentFetcher::getAvailableWindowSize(int64_t windowLimit) const
+{
   int64_t availableWindowSize;
   if (m_options.inOrder) {
-    availableWindowSize = std::min<int64_t>(m_cwnd, m_options.flowControlWindow - m_segmentBuffer.size());
+    availableWindowSize = std::min<int64_t>(windowLimit,
+                                            m_options.flowControlWindow - m_segmentBuffer.size());
+    if (m_nReceived > 0 && m_nBytesReceived > 0) {
+      // limit the segments in flight, which may all end up in the reorder buffer, to the
+      // remaining memory budget, assuming the average segment size seen so far
+      auto avgSegmentSize = static_cast<size_t>(m_nBytesReceived / m_nReceived) + 1;
+      auto remainingBytes = m_options.flowControlBytes - std::min(m_nBufferedBytes,
+                                                                  m_options.flowControlBytes);
+      availableWindowSize = std::min<int64_t>(availableWindowSize,
+                                              std::min<size_t>(remainingBytes / avgSegmentSize,
+                                                               std::numeric_limits<int64_t>::max()));
+    }
+    // always keep one Interest in flight, which retrieves the missing segment first
+    availableWindowSize = std::max<int64_t>(availableWindowSize, 1);
   }
   else {
-    availableWindowSize = static_cast<int64_t>(m_cwnd);
+    availableWindowSize = windowLimit;
   }
-  availableWindowSize -= m_nSegmentsInFlight;
+  return availableWindowSize - getNOutstanding();
+}
 
+size_t
+SegmentFetcher::fetchSegments(const Interest& origInterest, int64_t availableWindowSize)
+{
   std::vector<std::pair<uint64_t, bool>> segmentsToRequest; // The boolean indicates whether a retx or not
 
-  while (availableWindowSize > 0) {
-    if (!m_retxQueue.empty()) {
-      auto pendingSegmentIt = m_pendingSegments.find(m_retxQueue.front());
-      m_retxQueue.pop();
-      if (pendingSegmentIt == m_pendingSegments.end()) {
-        // Skip re-requesting this segment, since it was received after RTO timeout
-        continue;
-      }
-      BOOST_ASSERT(pendingSegmentIt->second.state == SegmentState::InRetxQueue);
-      segmentsToRequest.emplace_back(pendingSegmentIt->first, true);
-    }
-    else if (m_nSegments == 0 || m_nextSegmentNum < static_cast<uint64_t>(m_nSegments)) {
-      if (m_segmentBuffer.count(m_nextSegmentNum) > 0) {
-        // Don't request a segment a second time if received in response to first "discovery" Interest
-        m_nextSegmentNum++;
-        continue;
-      }
-      segmentsToRequest.emplace_back(m_nextSegmentNum++, false);
+  // Retransmit lost segments first, lowest segment number first
+  size_t nRetx = m_nSegmentsInRetxQueue;
+  for (auto seg = m_pendingSegments.getBegin();
+       nRetx > 0 && availableWindowSize > 0 && seg < m_pendingSegments.getEnd(); ++seg) {
+    auto* pendingSegment = m_pendingSegments.find(seg);
+    if (pendingSegment != nullptr && pendingSegment->state == SegmentState::InRetxQueue) {
+      segmentsToRequest.emplace_back(seg, true);
+      --nRetx;
+      --availableWindowSize;
     }
-    else {
-      break;
+  }
+
+  while (availableWindowSize > 0 &&
+         (m_nSegments == 0 || m_nextSegmentNum < static_cast<uint64_t>(m_nSegments))) {
+    if (isSegmentReceived(m_nextSegmentNum)) {
+      // Don't request a segment a second time if received in response to first "discovery" Interest
+      m_nextSegmentNum++;
+      continue;
     }
+    segmentsToRequest.emplace_back(m_nextSegmentNum++, false);
     availableWindowSize--;
   }
 
@@ -174,6 +234,40 @@ SegmentFetcher::fetchSegmentsInWindow(const Interest& origInterest)
     interest.refreshNonce();
     sendInterest(segment.first, interest, segment.second);
   }
+  return segmentsToRequest.size();
+}
+
+void
+SegmentFetcher::updateManagerOutstanding(int64_t delta)
+{
+  if (m_manager != nullptr) {
+    m_manager->m_nOutstanding += delta;
+  }
+}
+
+bool
+SegmentFetcher::canSendManagedInterest() const
+{
+  if (!m_hasSentFirstInterest) {
+    return true;
+  }
+  // wait for the first segment, which reveals the version
+  if (m_nReceived == 0) {
+    return false;
+  }
+  return (m_nSegmentsInRetxQueue > 0 ||
+          m_nSegments == 0 || m_nextSegmentNum < static_cast<uint64_t>(m_nSegments)) &&
+         getAvailableWindowSize(std::numeric_limits<int64_t>::max()) > 0;
+}
+
+bool
+SegmentFetcher::sendManagedInterest()
+{
+  if (!m_hasSentFirstInterest) {
+    fetchFirstSegment(m_baseInterest, false);
+    return true;
+  }
+  return fetchSegments(m_baseInterest, 1) > 0;
 }
 
 void
@@ -182,6 +276,7 @@ SegmentFetcher::sendInterest(uint64_t segNum, const Interest& interest, bool isR
   weak_ptr<SegmentFetcher> weakSelf = m_this;
 
   ++m_nSegmentsInFlight;
+  updateManagerOutstanding(1);
   auto pendingInterest = m_face.expressInterest(interest,
     [this, weakSelf] (const Interest& interest, const Data& data) {
       afterSegmentReceivedCb(interest, data, weakSelf);
@@ -192,7 +287,7 @@ SegmentFetcher::sendInterest(uint64_t segNum, const Interest& interest, bool isR
     nullptr);
 
   auto timeout = m_options.useConstantInterestTimeout ? m_options.maxTimeout : getEstimatedRto();
-  auto timeoutEvent = m_scheduler.schedule(timeout, [this, interest, weakSelf] {
+  auto timeoutEvent = m_scheduler->schedule(timeout, [this, interest, weakSelf] {
     afterTimeoutCb(interest, weakSelf);
   });
 
@@ -203,7 +298,7 @@ SegmentFetcher::sendInterest(uint64_t segNum, const Interest& interest, bool isR
 
   PendingSegment pendingSegment{SegmentState::FirstInterest, time::steady_clock::now(),
                                 pendingInterest, timeoutEvent};
-  bool isNew = m_pendingSegments.try_emplace(segNum, std::move(pendingSegment)).second;
+  bool isNew = m_pendingSegments.tryEmplace(segNum, std::move(pendingSegment)).second;
   BOOST_VERIFY(isNew);
   m_highInterest = segNum;
 }
@@ -215,9 +310,6 @@ SegmentFetcher::afterSegmentReceivedCb(const Interest& origInterest, const Data&
   if (shouldStop(weakSelf))
     return;
 
-  BOOST_ASSERT(m_nSegmentsInFlight > 0);
-  m_nSegmentsInFlight--;
-
   name::Component currentSegmentComponent = data.getName().get(-1);
   if (!currentSegmentComponent.isSegment()) {
     return signalError(DATA_HAS_NO_SEGMENT, "Data Name has no segment number");
@@ -226,35 +318,149 @@ SegmentFetcher::afterSegmentReceivedCb(const Interest& origInterest, const Data&
   uint64_t currentSegment = currentSegmentComponent.toSegment();
 
   // The first received Interest could have any segment ID
-  std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt;
-  if (m_receivedSegments.size() > 0) {
-    pendingSegmentIt = m_pendingSegments.find(currentSegment);
-  }
-  else {
-    pendingSegmentIt = m_pendingSegments.begin();
+  uint64_t pendingSegmentNum = m_nReceived > 0 ? currentSegment : 0;
+  auto* pendingSegment = m_pendingSegments.find(pendingSegmentNum);
+  if (pendingSegment == nullptr || pendingSegment->state == SegmentState::Validating) {
+    return;
   }
 
-  if (pendingSegmentIt == m_pendingSegments.end()) {
-    return;
+  // An Interest that timed out is no longer counted as in flight, even though its Data can
+  // still arrive before it is retransmitted
+  if (pendingSegment->state != SegmentState::InRetxQueue) {
+    BOOST_ASSERT(m_nSegmentsInFlight > 0);
+    m_nSegmentsInFlight--;
+    updateManagerOutstanding(-1);
   }
+  pendingSegment->timeoutEvent.cancel();
 
-  pendingSegmentIt->second.timeoutEvent.cancel();
+  // Take the RTT sample now, as validation may be delayed by a backlog of other segments
+  std::optional<time::nanoseconds> rtt;
+  if (pendingSegment->state == SegmentState::FirstInterest) {
+    rtt = time::steady_clock::now() - pendingSegment->sendTime;
+  }
+  else if (pendingSegment->state == SegmentState::InRetxQueue) {
+    m_nSegmentsInRetxQueue--;
+  }
+  pendingSegment->state = SegmentState::Validating;
+  ++m_nSegmentsValidating;
+  updateManagerOutstanding(1);
 
   afterSegmentReceived(data);
 
-  m_validator.validate(data,
-    [=] (const Data& d) { afterValidationSuccess(d, origInterest, pendingSegmentIt, weakSelf); },
+  validateSegment(data,
+    [=] (const Data& d) { afterValidationSuccess(d, origInterest, pendingSegmentNum, rtt, weakSelf); },
     [=] (const Data& d, const auto& error) { afterValidationFailure(d, error, weakSelf); });
 }
 
+void
+SegmentFetcher::validateSegment(const Data& data,
+                                const security::DataValidationSuccessCallback& successCb,
+                                const security::DataValidationFailureCallback& failureCb)
+{
+  if (!m_options.useManifest || data.getSignatureType() != tlv::DigestSha256) {
+    return m_validator.validate(data, successCb, failureCb);
+  }
+
+  if (m_manifest != nullptr) {
+    return validateByManifest(data, successCb, failureCb);
+  }
+
+  if (m_manifestFetcher == nullptr && m_manifestDepth >= MAX_MANIFEST_DEPTH) {
+    // a producer that signs every manifest segment with DigestSha256 would otherwise make
+    // the fetcher follow manifests of manifests forever
+    return failureCb(data, {security::ValidationError::POLICY_ERROR,
+                            "Manifests are nested more than " + to_string(MAX_MANIFEST_DEPTH) +
+                            " levels deep"});
+  }
+
+  m_awaitingManifest.push_back({data, successCb, failureCb});
+  if (m_manifestFetcher == nullptr) {
+    fetchManifest(data.getName().getPrefix(-1));
+  }
+}
+
+void
+SegmentFetcher::fetchManifest(const Name& versionedDataName)
+{
+  // the manifest is an object of its own, whose top-level segment is signed with a key,
+  // and whose other segments are in turn validated by the manifest of the manifest
+  Interest interest(Name(versionedDataName).append(Segmenter::getManifestComponent())
+                                           .appendSegment(0));
+
+  Options options = m_options;
+  options.inOrder = false;
+  options.probeLatestVersion = false;
+  if (m_manager != nullptr) {
+    // share the window of the manager, like the object itself
+    m_manifestFetcher = m_manager->fetchDependency(*this, interest, options);
+  }
+  else {
+    m_manifestFetcher = start(m_face, interest, m_validator, options);
+  }
+  m_manifestFetcher->m_manifestDepth = m_manifestDepth + 1;
+
+  weak_ptr<SegmentFetcher> weakSelf = m_this;
+  m_manifestFetcher->onComplete.connect([this, weakSelf] (ConstBufferPtr manifest) {
+    if (shouldStop(weakSelf))
+      return;
+
+    m_manifest = std::move(manifest);
+    auto awaiting = std::move(m_awaitingManifest);
+    m_awaitingManifest.clear();
+    for (const auto& entry : awaiting) {
+      validateByManifest(entry.data, entry.successCb, entry.failureCb);
+    }
+  });
+  m_manifestFetcher->onError.connect([this, weakSelf] (uint32_t, const std::string& msg) {
+    if (shouldStop(weakSelf))
+      return;
+
+    signalError(SEGMENT_VALIDATION_FAIL, "Cannot retrieve manifest: " + msg);
+  });
+}
+
+void
+SegmentFetcher::validateByManifest(const Data& data,
+                                   const security::DataValidationSuccessCallback& successCb,
+                                   const security::DataValidationFailureCallback& failureCb)
+{
+  BOOST_ASSERT(m_manifest != nullptr);
+  constexpr size_t digestSize = util::Sha256::DIGEST_SIZE;
+
+  uint64_t segment = data.getName()[-1].toSegment();
+  if (segment >= m_manifest->size() / digestSize) {
+    return failureCb(data, {security::ValidationError::POLICY_ERROR,
+                            "Segment " + to_string(segment) + " is not in the manifest"});
+  }
+
+  auto digest = data.getFullName()[-1];
+  if (!std::equal(digest.value_begin(), digest.value_end(),
+                  m_manifest->begin() + segment * digestSize)) {
+    return failureCb(data, {security::ValidationError::INVALID_SIGNATURE,
+                            "Digest of segment " + to_string(segment) +
+                            " does not match the manifest"});
+  }
+
+  successCb(data);
+}
+
 void
 SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInterest,
-                                       std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt,
+                                       uint64_t pendingSegmentNum, std::optional<time::nanoseconds> rtt,
                                        const weak_ptr<SegmentFetcher>& weakSelf)
 {
   if (shouldStop(weakSelf))
     return;
 
+  BOOST_ASSERT(m_nSegmentsValidating > 0);
+  m_nSegmentsValidating--;
+  updateManagerOutstanding(-1);
+
+  if (m_pendingSegments.find(pendingSegmentNum) == nullptr) {
+    // The segment is past the end of the object, as learned while it was being validated
+    return fetchSegmentsInWindow(origInterest);
+  }
+
   // We update the last receive time here instead of in the segment received callback so that the
   // transfer will not fail to terminate if we only received invalid Data packets.
   m_timeLastSegmentReceived = time::steady_clock::now();
@@ -263,24 +469,27 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
 
   // It was verified in afterSegmentReceivedCb that the last Data name component is a segment number
   uint64_t currentSegment = data.getName().get(-1).toSegment();
-  m_receivedSegments.insert(currentSegment);
+  markSegmentReceived(currentSegment);
 
   // Add measurement to RTO estimator (if not retransmission)
-  if (pendingSegmentIt->second.state == SegmentState::FirstInterest) {
+  if (rtt) {
     BOOST_ASSERT(m_nSegmentsInFlight >= 0);
-    m_rttEstimator.addMeasurement(m_timeLastSegmentReceived - pendingSegmentIt->second.sendTime,
-                                  static_cast<size_t>(m_nSegmentsInFlight) + 1);
-  }
-
-  // Remove from pending segments map
-  m_pendingSegments.erase(pendingSegmentIt);
-
-  // Copy data in segment to temporary buffer
-  auto receivedSegmentIt = m_segmentBuffer.try_emplace(currentSegment, data.getContent().value_size())
-                           .first;
-  std::copy(data.getContent().value_begin(), data.getContent().value_end(),
-            receivedSegmentIt->second.begin());
-  m_nBytesReceived += data.getContent().value_size();
+    auto nInFlight = m_manager != nullptr ? m_manager->m_nOutstanding : m_nSegmentsInFlight;
+    // With one sample per segment, the gains are scaled down so that the estimate moves by about
+    // one regular update per RTT. A sample beyond the expected variation, however, is applied with
+    // full weight: when a queue builds up, e.g., at the end of slow start, the RTT can grow faster
+    // than a damped estimate, and every Interest sent in the meantime would time out spuriously.
+    bool isOutlier = *rtt > m_rttEstimator->getSmoothedRtt() + m_rttEstimator->getRttVariation();
+    m_rttEstimator->addMeasurement(*rtt, isOutlier ? 1 : static_cast<size_t>(nInFlight) + 1);
+  }
+
+  // Remove from pending segments
+  auto sendTime = m_pendingSegments.find(pendingSegmentNum)->sendTime;
+  m_pendingSegments.erase(pendingSegmentNum);
+  m_pendingSegments.trimFront();
+
+  const auto& content = data.getContent();
+  m_nBytesReceived += content.value_size();
   afterSegmentValidated(data);
 
   if (data.getFinalBlock()) {
@@ -296,13 +505,27 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
   }
 
   if (m_options.inOrder && m_nextSegmentInOrder == currentSegment) {
-    do {
-      onInOrderData(std::make_shared<const Buffer>(m_segmentBuffer[m_nextSegmentInOrder]));
-      m_segmentBuffer.erase(m_nextSegmentInOrder++);
-    } while (m_segmentBuffer.count(m_nextSegmentInOrder) > 0);
+    // deliver this segment directly, then any buffered segments that follow it
+    deliverInOrder(content.value_bytes());
+    auto it = m_segmentBuffer.begin();
+    while (it != m_segmentBuffer.end() && it->first == m_nextSegmentInOrder) {
+      deliverInOrder(it->second.value_bytes());
+      m_nBufferedBytes -= it->second.value_size();
+      it = m_segmentBuffer.erase(it);
+    }
+  }
+  else if (m_options.inOrder && currentSegment < m_nextSegmentInOrder) {
+    // already delivered
+  }
+  else {
+    // keep a reference to the content, which shares memory with the Data packet
+    bool isNew = m_segmentBuffer.try_emplace(currentSegment, content).second;
+    if (isNew && m_options.inOrder) {
+      m_nBufferedBytes += content.value_size();
+    }
   }
 
-  if (m_receivedSegments.size() == 1) {
+  if (m_nReceived == 1) {
     m_versionedDataName = data.getName().getPrefix(-1);
     if (currentSegment == 0) {
       // We received the first segment in response, so we can increment the next segment number
@@ -315,10 +538,10 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
   }
 
   if (data.getCongestionMark() > 0 && !m_options.ignoreCongMarks) {
-    windowDecrease();
+    windowDecrease(sendTime);
   }
   else {
-    windowIncrease();
+    windowIncrease(rtt);
   }
 
   fetchSegmentsInWindow(origInterest);
@@ -332,6 +555,10 @@ SegmentFetcher::afterValidationFailure(const Data&,
   if (shouldStop(weakSelf))
     return;
 
+  BOOST_ASSERT(m_nSegmentsValidating > 0);
+  m_nSegmentsValidating--;
+  updateManagerOutstanding(-1);
+
   signalError(SEGMENT_VALIDATION_FAIL, "Segment validation failed: " + boost::lexical_cast<std::string>(error));
 }
 
@@ -346,6 +573,7 @@ SegmentFetcher::afterNackReceivedCb(const Interest& origInterest, const lp::Nack
 
   BOOST_ASSERT(m_nSegmentsInFlight > 0);
   m_nSegmentsInFlight--;
+  updateManagerOutstanding(-1);
 
   switch (nack.getReason()) {
     case lp::NackReason::DUPLICATE:
@@ -369,6 +597,7 @@ SegmentFetcher::afterTimeoutCb(const Interest& origInterest,
 
   BOOST_ASSERT(m_nSegmentsInFlight > 0);
   m_nSegmentsInFlight--;
+  updateManagerOutstanding(-1);
   afterNackOrTimeout(origInterest);
 }
 
@@ -383,28 +612,34 @@ SegmentFetcher::afterNackOrTimeout(const Interest& origInterest)
   BOOST_ASSERT(!m_pendingSegments.empty());
 
   const auto& origName = origInterest.getName();
-  std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt;
+  uint64_t segmentNum = 0; // First Interest
   if (!origName.empty() && origName[-1].isSegment()) {
-    pendingSegmentIt = m_pendingSegments.find(origName[-1].toSegment());
-    BOOST_ASSERT(pendingSegmentIt != m_pendingSegments.end());
-  }
-  else { // First Interest
-    pendingSegmentIt = m_pendingSegments.begin();
+    segmentNum = origName[-1].toSegment();
   }
+  auto* pendingSegment = m_pendingSegments.find(segmentNum);
+  BOOST_ASSERT(pendingSegment != nullptr);
 
   // Cancel timeout event and set status to InRetxQueue
-  pendingSegmentIt->second.timeoutEvent.cancel();
-  pendingSegmentIt->second.state = SegmentState::InRetxQueue;
+  pendingSegment->timeoutEvent.cancel();
+  if (pendingSegment->state != SegmentState::InRetxQueue) {
+    pendingSegment->state = SegmentState::InRetxQueue;
+    m_nSegmentsInRetxQueue++;
+  }
 
-  m_rttEstimator.backoffRto();
+  // Back off once per loss episode, as with the single retransmission timer of TCP. The Interests
+  // that were in flight together expire together, and backing off for each of them would push
+  // the RTO, and the timeout of the retransmissions, to its maximum after a single burst of losses.
+  if (pendingSegment->sendTime >= m_timeLastRtoBackoff) {
+    m_rttEstimator->backoffRto();
+    m_timeLastRtoBackoff = time::steady_clock::now();
+  }
 
-  if (m_receivedSegments.empty()) {
+  if (m_nReceived == 0) {
     // Resend first Interest (until maximum receive timeout exceeded)
     fetchFirstSegment(origInterest, true);
   }
   else {
-    windowDecrease();
-    m_retxQueue.push(pendingSegmentIt->first);
+    windowDecrease(pendingSegment->sendTime);
     fetchSegmentsInWindow(origInterest);
   }
 }
@@ -416,49 +651,63 @@ SegmentFetcher::finalizeFetch()
     onInOrderComplete();
   }
   else {
-    // Combine segments into final buffer
-    OBufferStream buf;
-    // We may have received more segments than exist in the object.
-    BOOST_ASSERT(m_receivedSegments.size() >= static_cast<uint64_t>(m_nSegments));
+    BOOST_ASSERT(checkAllSegmentsReceived());
 
+    std::vector<Block> segments;
+    segments.reserve(static_cast<size_t>(m_nSegments));
+    size_t totalSize = 0;
     for (int64_t i = 0; i < m_nSegments; i++) {
-      buf.write(m_segmentBuffer[i].get<const char>(), m_segmentBuffer[i].size());
+      segments.push_back(m_segmentBuffer[i]);
+      totalSize += segments.back().value_size();
+    }
+    m_segmentBuffer.clear();
+    onCompleteSegments(segments);
+
+    if (!onComplete.isEmpty()) {
+      // Combine segments into final buffer, copying each segment exactly once
+      auto buf = std::make_shared<Buffer>(totalSize);
+      auto pos = buf->begin();
+      for (const auto& segment : segments) {
+        pos = std::copy(segment.value_begin(), segment.value_end(), pos);
+      }
+      onComplete(std::move(buf));
     }
-    onComplete(buf.buf());
   }
   stop();
 }
 
 void
-SegmentFetcher::windowIncrease()
+SegmentFetcher::windowIncrease(std::optional<time::nanoseconds> rtt)
 {
   if (m_options.useConstantCwnd) {
-    BOOST_ASSERT(m_cwnd == m_options.initCwnd);
+    BOOST_ASSERT(m_cc->getCwnd() == m_options.initCwnd);
     return;
   }
 
-  if (m_cwnd < m_ssthresh) {
-    m_cwnd += m_options.aiStep; // additive increase
-  }
-  else {
-    m_cwnd += m_options.aiStep / std::floor(m_cwnd); // congestion avoidance
-  }
+  m_cc->afterReceiveData(rtt);
 }
 
 void
-SegmentFetcher::windowDecrease()
+SegmentFetcher::windowDecrease(time::steady_clock::time_point sendTime)
 {
-  if (m_options.disableCwa || m_highData > m_recPoint) {
+  if (m_manager != nullptr) {
+    return m_manager->afterCongestionEvent(sendTime);
+  }
+
+  // React to at most one congestion event per window of data. As losses are detected by timeouts,
+  // which expire more than one RTT after the Interest was sent, Data beyond the recovery point
+  // may have arrived by the time that the other losses of the same episode are detected: only
+  // segments requested after the last decrease can start a new episode.
+  if (m_options.disableCwa || (m_highData > m_recPoint && sendTime > m_timeLastWindowDecrease)) {
     m_recPoint = m_highInterest;
+    m_timeLastWindowDecrease = time::steady_clock::now();
 
     if (m_options.useConstantCwnd) {
-      BOOST_ASSERT(m_cwnd == m_options.initCwnd);
+      BOOST_ASSERT(m_cc->getCwnd() == m_options.initCwnd);
       return;
     }
 
-    // Refer to RFC 5681, Section 3.1 for the rationale behind the code below
-    m_ssthresh = std::max(MIN_SSTHRESH, m_cwnd * m_options.mdCoef); // multiplicative decrease
-    m_cwnd = m_options.resetCwndToInit ? m_options.initCwnd : m_ssthresh;
+    m_cc->afterCongestionEvent();
   }
 }
 
@@ -474,46 +723,84 @@ SegmentFetcher::updateRetransmittedSegment(uint64_t segmentNum,
                                            const PendingInterestHandle& pendingInterest,
                                            scheduler::EventId timeoutEvent)
 {
-  auto pendingSegmentIt = m_pendingSegments.find(segmentNum);
-  BOOST_ASSERT(pendingSegmentIt != m_pendingSegments.end());
-  BOOST_ASSERT(pendingSegmentIt->second.state == SegmentState::InRetxQueue);
-  pendingSegmentIt->second.state = SegmentState::Retransmitted;
-  pendingSegmentIt->second.hdl = pendingInterest; // cancels previous pending Interest via scoped handle
-  pendingSegmentIt->second.timeoutEvent = timeoutEvent;
+  auto* pendingSegment = m_pendingSegments.find(segmentNum);
+  BOOST_ASSERT(pendingSegment != nullptr);
+  BOOST_ASSERT(pendingSegment->state == SegmentState::InRetxQueue);
+  pendingSegment->state = SegmentState::Retransmitted;
+  pendingSegment->sendTime = time::steady_clock::now();
+  pendingSegment->hdl = pendingInterest; // cancels previous pending Interest via scoped handle
+  pendingSegment->timeoutEvent = timeoutEvent;
+  m_nSegmentsInRetxQueue--;
 }
 
 void
 SegmentFetcher::cancelExcessInFlightSegments()
 {
-  for (auto it = m_pendingSegments.begin(); it != m_pendingSegments.end();) {
-    if (it->first >= static_cast<uint64_t>(m_nSegments)) {
-      it = m_pendingSegments.erase(it); // cancels pending Interest and timeout event
+  auto first = std::max(m_pendingSegments.getBegin(), static_cast<uint64_t>(m_nSegments));
+  for (auto seg = first; seg < m_pendingSegments.getEnd(); ++seg) {
+    auto* pendingSegment = m_pendingSegments.find(seg);
+    if (pendingSegment == nullptr) {
+      continue;
+    }
+    if (pendingSegment->state == SegmentState::InRetxQueue) {
+      m_nSegmentsInRetxQueue--;
+    }
+    else if (pendingSegment->state != SegmentState::Validating) {
       BOOST_ASSERT(m_nSegmentsInFlight > 0);
       m_nSegmentsInFlight--;
+      updateManagerOutstanding(-1);
     }
-    else {
-      ++it;
-    }
+    m_pendingSegments.erase(seg); // cancels pending Interest and timeout event
   }
 }
 
 bool
-SegmentFetcher::checkAllSegmentsReceived()
+SegmentFetcher::isSegmentReceived(uint64_t segmentNum) const
 {
-  bool haveReceivedAllSegments = false;
+  return segmentNum < m_nSegmentsReceivedInOrder || m_receivedSegments.find(segmentNum) != nullptr;
+}
 
-  if (m_nSegments != 0 && m_nReceived >= m_nSegments) {
-    haveReceivedAllSegments = true;
-    // Verify that all segments in window have been received. If not, send Interests for missing segments.
-    for (uint64_t i = 0; i < static_cast<uint64_t>(m_nSegments); i++) {
-      if (m_receivedSegments.count(i) == 0) {
-        m_retxQueue.push(i);
-        haveReceivedAllSegments = false;
-      }
+void
+SegmentFetcher::markSegmentReceived(uint64_t segmentNum)
+{
+  if (segmentNum < m_nSegmentsReceivedInOrder) {
+    return;
+  }
+  // A segment that has been requested is never requested again once received, so it must be
+  // recorded however far it is from the next missing segment, e.g., after the window shrinks.
+  // The first segment, however, can have any number. Rather than holding a slot for every
+  // segment before it, do not record a segment that is beyond the window and not yet requested:
+  // it is requested again when the window reaches it.
+  if (segmentNum >= m_nextSegmentNum) {
+    auto maxSpan = static_cast<uint64_t>(m_cc->getCwnd()) + m_options.flowControlWindow;
+    if (segmentNum - m_nSegmentsReceivedInOrder >= maxSpan ||
+        segmentNum == std::numeric_limits<uint64_t>::max()) {
+      return;
     }
   }
+  m_receivedSegments.tryEmplace(segmentNum, true);
+  // forget the segments that are received in a row
+  while (m_receivedSegments.find(m_nSegmentsReceivedInOrder) != nullptr) {
+    m_receivedSegments.popFront();
+    ++m_nSegmentsReceivedInOrder;
+  }
+}
 
-  return haveReceivedAllSegments;
+bool
+SegmentFetcher::checkAllSegmentsReceived() const
+{
+  // We may have received more segments than exist in the object, which do not count
+  return m_nSegments != 0 && m_nSegmentsReceivedInOrder >= static_cast<uint64_t>(m_nSegments);
+}
+
+void
+SegmentFetcher::deliverInOrder(span<const uint8_t> content)
+{
+  ++m_nextSegmentInOrder;
+  onInOrderContent(content);
+  if (!onInOrderData.isEmpty()) {
+    onInOrderData(std::make_shared<const Buffer>(content.begin(), content.end()));
+  }
 }
 
 time::milliseconds
@@ -522,7 +809,7 @@ SegmentFetcher::getEstimatedRto()
   // We don't want an Interest timeout greater than the maximum allowed timeout between the
   // succesful receipt of segments
   return std::min(m_options.maxTimeout,
-                  time::duration_cast<time::milliseconds>(m_rttEstimator.getEstimatedRto()));
+                  time::duration_cast<time::milliseconds>(m_rttEstimator->getEstimatedRto()));
 }
 
 } // namespace ndn
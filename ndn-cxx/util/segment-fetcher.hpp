@@ -23,16 +23,19 @@
 #define NDN_CXX_UTIL_SEGMENT_FETCHER_HPP
 
 #include "ndn-cxx/face.hpp"
+#include "ndn-cxx/detail/segment-ring.hpp"
 #include "ndn-cxx/security/validator.hpp"
+#include "ndn-cxx/util/congestion-control.hpp"
 #include "ndn-cxx/util/rtt-estimator.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
 #include "ndn-cxx/util/signal/signal.hpp"
 
-#include <queue>
-#include <set>
+#include <map>
 
 namespace ndn {
 
+class FetchManager;
+
 /**
  * \brief Options for SegmentFetcher.
  */
@@ -52,22 +55,33 @@ struct SegmentFetcherOptions
   bool useConstantCwnd = false;
   /// Disable Conservative Window Adaptation
   bool disableCwa = false;
-  /// Reduce cwnd to #initCwnd when a loss event occurs
+  /// Reduce cwnd to #initCwnd when a loss event occurs, for AIMD
   bool resetCwndToInit = false;
   /// Disable window decrease after a congestion mark is received
   bool ignoreCongMarks = false;
+  /// Congestion control algorithm
+  util::CongestionControlAlgorithm congestionControl = util::CongestionControlAlgorithm::AIMD;
+  /// If set, creates the congestion controller, overriding #congestionControl
+  std::function<unique_ptr<util::CongestionControl>(const util::CongestionControl::Options&)>
+    makeCongestionControl;
   /// Initial congestion window size
   double initCwnd = 1.0;
   /// Initial slow start threshold
   double initSsthresh = std::numeric_limits<double>::max();
-  /// Additive increase step (in segments)
+  /// Additive increase step (in segments), for AIMD
   double aiStep = 1.0;
-  /// Multiplicative decrease coefficient
+  /// Multiplicative decrease coefficient, for AIMD
   double mdCoef = 0.5;
   /// Options for the RTT estimator
   util::RttEstimator::Options rttOptions;
   /// Maximum number of segments stored in the reorder buffer
   size_t flowControlWindow = 25000;
+  /// Maximum number of octets of segment content stored in the reorder buffer
+  size_t flowControlBytes = std::numeric_limits<size_t>::max();
+  /// Authenticate segments signed with DigestSha256 by their digests in the manifest of
+  /// the object, as published by Segmenter::segmentWithManifest. At most
+  /// SegmentFetcher::MAX_MANIFEST_DEPTH levels of manifests are followed.
+  bool useManifest = false;
 
   void
   validate();
@@ -102,19 +116,28 @@ struct SegmentFetcherOptions
  *    indicated by the FinalBlockId in a received Data packet is reached. This retrieval will start
  *    at segment 1 if segment 0 was received in response to the Interest expressed in step 2;
  *    otherwise, retrieval will start at segment 0. By default, congestion control will be used to
- *    manage the Interest window size. Interests expressed in this step will follow this Name
- *    format: `/<prefix>/<version>/<segment=(N)>`.
+ *    manage the Interest window size, with the algorithm selected by Options::congestionControl.
+ *    Interests expressed in this step will follow this Name format:
+ *    `/<prefix>/<version>/<segment=(N)>`.
  *
- * 4. If set to 'block' mode, signal #onComplete passing a memory buffer that combines the content
- *    of all segments in the object. If set to 'in order' mode, signal #onInOrderData is triggered
- *    upon validation of each segment in segment order, storing later segments that arrived out of
- *    order internally until all earlier segments have arrived and have been validated.
+ * 4. If set to 'block' mode, signal #onCompleteSegments passing the content of all segments, and
+ *    #onComplete passing a memory buffer that combines the content of all segments in the object.
+ *    If set to 'in order' mode, signals #onInOrderContent and #onInOrderData are triggered upon
+ *    validation of each segment in segment order, storing later segments that arrived out of
+ *    order internally until all earlier segments have arrived and have been validated. In this
+ *    mode, the Interest window is limited so that the reorder buffer does not exceed
+ *    Options::flowControlWindow segments and Options::flowControlBytes octets, which allows
+ *    fetching an object of any size with bounded memory.
  *
  * If an error occurs during the fetching process, #onError is signaled with one of the error codes
  * from SegmentFetcher::ErrorCode.
  *
  * A Validator instance must be specified to validate individual segments. Every time a segment has
- * been successfully validated, #afterSegmentValidated will be signaled.
+ * been successfully validated, #afterSegmentValidated will be signaled. Validation may complete
+ * asynchronously and out of order, e.g., when signatures are verified on worker threads as enabled
+ * by Validator::setVerificationThreads(). Segments awaiting validation count against the Interest
+ * window, so that the retrieval slows down to the rate at which segments can be validated, and
+ * RTT samples are taken upon receipt, so that they do not include the validation delay.
  *
  * Example:
  * @code
@@ -144,6 +167,15 @@ public:
 
   using Options = SegmentFetcherOptions;
 
+  /**
+   * @brief Maximum number of nested manifests, i.e., manifests of manifests, of an object.
+   *
+   * Each manifest level has at most half as many segments as the level below it, so this
+   * covers objects of up to 2^16 segments with the smallest segments accepted by
+   * Segmenter::segmentWithManifest, and of any size with segments of 512 octets or more.
+   */
+  static constexpr size_t MAX_MANIFEST_DEPTH = 16;
+
   /**
    * @brief Initiates segment fetching.
    *
@@ -183,7 +215,11 @@ public:
 private:
   class PendingSegment;
 
-  SegmentFetcher(Face& face, security::Validator& validator, const Options& options);
+  SegmentFetcher(Face& face, security::Validator& validator, const Options& options,
+                 FetchManager* manager = nullptr);
+
+  static unique_ptr<util::CongestionControl>
+  makeCongestionControl(const Options& options);
 
   static bool
   shouldStop(const weak_ptr<SegmentFetcher>& weakSelf);
@@ -194,6 +230,49 @@ private:
   void
   fetchSegmentsInWindow(const Interest& origInterest);
 
+  /**
+   * @brief Returns how many more Interests the limits of this object allow to be outstanding.
+   * @param windowLimit congestion window, or the maximum value of int64_t if the window is
+   *                    enforced by a FetchManager
+   */
+  int64_t
+  getAvailableWindowSize(int64_t windowLimit) const;
+
+  /**
+   * @brief Sends Interests for up to @p availableWindowSize segments, retransmissions first.
+   * @return number of Interests sent
+   */
+  size_t
+  fetchSegments(const Interest& origInterest, int64_t availableWindowSize);
+
+  /**
+   * @brief Returns whether FetchManager may let this fetcher send an Interest now.
+   */
+  bool
+  canSendManagedInterest() const;
+
+  /**
+   * @brief Sends one Interest, as allowed by FetchManager.
+   * @return whether an Interest has been sent
+   */
+  bool
+  sendManagedInterest();
+
+  /**
+   * @brief Returns the number of Interests in flight and of segments awaiting validation.
+   */
+  int64_t
+  getNOutstanding() const
+  {
+    return m_nSegmentsInFlight + m_nSegmentsValidating;
+  }
+
+  /**
+   * @brief Reports a change of getNOutstanding() to the FetchManager, if any.
+   */
+  void
+  updateManagerOutstanding(int64_t delta);
+
   void
   sendInterest(uint64_t segNum, const Interest& interest, bool isRetransmission);
 
@@ -202,8 +281,8 @@ private:
                          const weak_ptr<SegmentFetcher>& weakSelf);
 
   void
-  afterValidationSuccess(const Data& data, const Interest& origInterest,
-                         std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt,
+  afterValidationSuccess(const Data& data, const Interest& origInterest, uint64_t pendingSegmentNum,
+                         std::optional<time::nanoseconds> rtt,
                          const weak_ptr<SegmentFetcher>& weakSelf);
 
   void
@@ -226,10 +305,13 @@ private:
   finalizeFetch();
 
   void
-  windowIncrease();
+  windowIncrease(std::optional<time::nanoseconds> rtt);
 
+  /**
+   * @brief Reacts to a congestion event on a segment requested at @p sendTime.
+   */
   void
-  windowDecrease();
+  windowDecrease(time::steady_clock::time_point sendTime);
 
   void
   signalError(uint32_t code, const std::string& msg);
@@ -243,7 +325,27 @@ private:
   cancelExcessInFlightSegments();
 
   bool
-  checkAllSegmentsReceived();
+  isSegmentReceived(uint64_t segmentNum) const;
+
+  void
+  markSegmentReceived(uint64_t segmentNum);
+
+  bool
+  checkAllSegmentsReceived() const;
+
+  void
+  deliverInOrder(span<const uint8_t> content);
+
+  void
+  validateSegment(const Data& data, const security::DataValidationSuccessCallback& successCb,
+                  const security::DataValidationFailureCallback& failureCb);
+
+  void
+  fetchManifest(const Name& versionedDataName);
+
+  void
+  validateByManifest(const Data& data, const security::DataValidationSuccessCallback& successCb,
+                     const security::DataValidationFailureCallback& failureCb);
 
   time::milliseconds
   getEstimatedRto();
@@ -255,6 +357,18 @@ public:
    */
   signal::Signal<SegmentFetcher, ConstBufferPtr> onComplete;
 
+  /**
+   * @brief Emitted upon successful retrieval of the complete object, with the Content element
+   *        of each segment in segment order.
+   *
+   * The Content elements share memory with the received Data packets, so the object is not
+   * copied. A handler that only needs to write the object somewhere should use this signal
+   * instead of #onComplete; if no handler is connected to #onComplete, the segments are never
+   * combined into a single buffer.
+   * @note Emitted only if SegmentFetcher is operating in 'block' mode, before #onComplete.
+   */
+  signal::Signal<SegmentFetcher, std::vector<Block>> onCompleteSegments;
+
   /**
    * @brief Emitted when the retrieval could not be completed due to an error.
    *
@@ -288,6 +402,21 @@ public:
    */
   signal::Signal<SegmentFetcher, ConstBufferPtr> onInOrderData;
 
+  /**
+   * @brief Emitted with the content of each data segment, in segment order.
+   *
+   * Unlike #onInOrderData, the content is not copied, and the span is only valid until the
+   * handler returns. This is the preferred way to stream a large object to a file or another
+   * sink, e.g.:
+   * @code
+   * fetcher->onInOrderContent.connect([&os] (span<const uint8_t> content) {
+   *   os.write(reinterpret_cast<const char*>(content.data()), content.size());
+   * });
+   * @endcode
+   * @note Emitted only if SegmentFetcher is operating in 'in order' mode.
+   */
+  signal::Signal<SegmentFetcher, span<const uint8_t>> onInOrderContent;
+
   /**
    * @brief Emitted on successful retrieval of all segments in 'in order' mode.
    * @note Emitted only if SegmentFetcher is operating in 'in order' mode.
@@ -299,46 +428,83 @@ private:
     FirstInterest, ///< the first Interest for this segment has been sent
     InRetxQueue,   ///< the segment is awaiting Interest retransmission
     Retransmitted, ///< one or more retransmitted Interests have been sent for this segment
+    Validating,    ///< the segment has been received and is awaiting validation
   };
 
   class PendingSegment
   {
   public:
     SegmentState state;
+    /// when the latest Interest for this segment was sent
     time::steady_clock::time_point sendTime;
     ScopedPendingInterestHandle hdl;
     scheduler::ScopedEventId timeoutEvent;
   };
 
-NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
-  static constexpr double MIN_SSTHRESH = 2.0;
+  struct AwaitingManifest
+  {
+    Data data;
+    security::DataValidationSuccessCallback successCb;
+    security::DataValidationFailureCallback failureCb;
+  };
 
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   shared_ptr<SegmentFetcher> m_this;
 
   Options m_options;
   Face& m_face;
-  Scheduler m_scheduler;
   security::Validator& m_validator;
-  util::RttEstimator m_rttEstimator;
+  /// if not null, the manager that owns the window shared with other objects
+  FetchManager* m_manager;
+  /// Interest from which all Interests of this fetcher are derived
+  Interest m_baseInterest;
+  bool m_hasSentFirstInterest = false;
+  // the scheduler, RTT estimator, and congestion controller are shared if m_manager is not null
+  shared_ptr<Scheduler> m_scheduler;
+  shared_ptr<util::RttEstimator> m_rttEstimator;
 
   time::steady_clock::time_point m_timeLastSegmentReceived;
-  std::queue<uint64_t> m_retxQueue;
+  /// when the RTO was last backed off; Interests sent before then do not back it off again
+  time::steady_clock::time_point m_timeLastRtoBackoff;
+  /// number of pending segments in SegmentState::InRetxQueue
+  size_t m_nSegmentsInRetxQueue = 0;
   Name m_versionedDataName;
   uint64_t m_nextSegmentNum = 0;
-  double m_cwnd;
-  double m_ssthresh;
+  shared_ptr<util::CongestionControl> m_cc;
   int64_t m_nSegmentsInFlight = 0;
+  /// number of received segments whose validation has not completed
+  int64_t m_nSegmentsValidating = 0;
   int64_t m_nSegments = 0;
   uint64_t m_highInterest = 0;
   uint64_t m_highData = 0;
   uint64_t m_recPoint = 0;
+  time::steady_clock::time_point m_timeLastWindowDecrease;
   int64_t m_nReceived = 0;
   int64_t m_nBytesReceived = 0;
   uint64_t m_nextSegmentInOrder = 0;
-
-  std::map<uint64_t, Buffer> m_segmentBuffer;
-  std::map<uint64_t, PendingSegment> m_pendingSegments;
-  std::set<uint64_t> m_receivedSegments;
+  /// total size of the content in m_segmentBuffer, in 'in order' mode
+  size_t m_nBufferedBytes = 0;
+
+  /// Content elements of received segments that have not been delivered
+  std::map<uint64_t, Block> m_segmentBuffer;
+  /// Segments that have been requested but not yet validated. The first Interest is stored as
+  /// segment zero, whichever segment it retrieves.
+  detail::SegmentRing<PendingSegment> m_pendingSegments;
+  /// All segments before this one have been validated
+  uint64_t m_nSegmentsReceivedInOrder = 0;
+  /// Segments after m_nSegmentsReceivedInOrder that have been validated
+  detail::SegmentRing<bool> m_receivedSegments;
+
+  /// retrieves the manifest, if Options::useManifest is enabled
+  shared_ptr<SegmentFetcher> m_manifestFetcher;
+  /// number of manifests above the object retrieved by this fetcher
+  size_t m_manifestDepth = 0;
+  /// concatenated digests of all segments, once the manifest has been retrieved
+  ConstBufferPtr m_manifest;
+  /// segments that cannot be validated until the manifest is retrieved
+  std::vector<AwaitingManifest> m_awaitingManifest;
+
+  friend FetchManager;
 };
 
 } // namespace ndn
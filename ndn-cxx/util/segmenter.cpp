@@ -20,6 +20,8 @@
  */
 
 #include "ndn-cxx/util/segmenter.hpp"
+#include "ndn-cxx/detail/mapped-file.hpp"
+#include "ndn-cxx/util/sha256.hpp"
 
 #include <boost/iostreams/read.hpp>
 
@@ -34,6 +36,77 @@ Segmenter::Segmenter(KeyChain& keyChain, const security::SigningInfo& signingInf
 std::vector<std::shared_ptr<Data>>
 Segmenter::segment(span<const uint8_t> buffer, const Name& dataName, size_t maxSegmentSize,
                    time::milliseconds freshnessPeriod, uint32_t contentType)
+{
+  return segmentImpl(buffer, dataName, maxSegmentSize, freshnessPeriod, contentType, m_signingInfo);
+}
+
+std::vector<std::shared_ptr<Data>>
+Segmenter::segmentFile(const std::string& filename, const Name& dataName, size_t maxSegmentSize,
+                       time::milliseconds freshnessPeriod, uint32_t contentType)
+{
+  unique_ptr<detail::MappedFile> file;
+  try {
+    file = make_unique<detail::MappedFile>(filename);
+  }
+  catch (const detail::MappedFile::Error& e) {
+    NDN_THROW_NESTED(Error(e.what()));
+  }
+
+  return segmentImpl(file->getContent(), dataName, maxSegmentSize, freshnessPeriod, contentType,
+                     m_signingInfo);
+}
+
+std::vector<std::shared_ptr<Data>>
+Segmenter::segmentWithManifest(span<const uint8_t> buffer, const Name& dataName,
+                               size_t maxSegmentSize, time::milliseconds freshnessPeriod,
+                               uint32_t contentType)
+{
+  // each manifest level must be smaller than the one below it
+  if (maxSegmentSize < 2 * util::Sha256::DIGEST_SIZE) {
+    NDN_THROW(std::invalid_argument("maxSegmentSize must be at least " +
+                                    to_string(2 * util::Sha256::DIGEST_SIZE)));
+  }
+
+  const security::SigningInfo digestSigning(security::SigningInfo::SIGNER_TYPE_SHA256);
+  auto packets = segmentImpl(buffer, dataName, maxSegmentSize, freshnessPeriod, contentType,
+                             buffer.size() > maxSegmentSize ? digestSigning : m_signingInfo);
+  if (packets.size() == 1) {
+    // nothing to amortize
+    return packets;
+  }
+
+  size_t levelBegin = 0;
+  Name levelName = dataName;
+  while (packets.size() - levelBegin > 1) {
+    Buffer manifest;
+    manifest.reserve((packets.size() - levelBegin) * util::Sha256::DIGEST_SIZE);
+    for (auto i = levelBegin; i < packets.size(); ++i) {
+      auto digest = packets[i]->getFullName()[-1];
+      manifest.insert(manifest.end(), digest.value_begin(), digest.value_end());
+    }
+
+    levelBegin = packets.size();
+    levelName.append(getManifestComponent());
+    auto level = segmentImpl(manifest, levelName, maxSegmentSize, freshnessPeriod,
+                             tlv::ContentType_Blob,
+                             manifest.size() > maxSegmentSize ? digestSigning : m_signingInfo);
+    packets.insert(packets.end(), level.begin(), level.end());
+  }
+
+  return packets;
+}
+
+name::Component
+Segmenter::getManifestComponent()
+{
+  static const std::string_view manifest("manifest");
+  return name::Component(tlv::KeywordNameComponent, manifest.begin(), manifest.end());
+}
+
+std::vector<std::shared_ptr<Data>>
+Segmenter::segmentImpl(span<const uint8_t> buffer, const Name& dataName, size_t maxSegmentSize,
+                       time::milliseconds freshnessPeriod, uint32_t contentType,
+                       const security::SigningInfo& signingInfo)
 {
   if (maxSegmentSize == 0) {
     NDN_THROW(std::invalid_argument("maxSegmentSize must be greater than 0"));
@@ -54,9 +127,11 @@ Segmenter::segment(span<const uint8_t> buffer, const Name& dataName, size_t maxS
     data->setContentType(contentType);
     data->setFreshnessPeriod(freshnessPeriod);
     data->setFinalBlock(finalBlockId);
+    // a Data packet cannot reference external memory, so the content is copied here, and once
+    // more into the wire encoding by KeyChain::sign()
     data->setContent(buffer.first(segLen));
 
-    m_keyChain.sign(*data, m_signingInfo);
+    m_keyChain.sign(*data, signingInfo);
     segments.push_back(std::move(data));
 
     buffer = buffer.subspan(segLen);
@@ -33,6 +33,12 @@ namespace ndn {
 class Segmenter
 {
 public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
   /**
    * @brief Constructor.
    * @param keyChain KeyChain instance used for signing the packets.
@@ -72,6 +78,69 @@ public:
           time::milliseconds freshnessPeriod,
           uint32_t contentType = tlv::ContentType_Blob);
 
+  /**
+   * @brief Creates one or more Data packets (segments) with the content of a file.
+   *
+   * The file is memory-mapped rather than read through a stream, which avoids the intermediate
+   * read buffer. It does not avoid copying the content: each segment is copied into the Content
+   * element of its Data packet, and again into the wire encoding when the packet is signed.
+   * The returned packets hold the whole file in memory.
+   *
+   * @param filename Path of the file.
+   * @param dataName Name prefix to use for the Data packets. A segment number will be appended to it.
+   * @param maxSegmentSize Maximum size of the `Content` element (payload) of each created Data packet.
+   * @param freshnessPeriod The `FreshnessPeriod` of created Data packets.
+   * @param contentType The `ContentType` of created Data packets.
+   * @throw Error the file cannot be opened or mapped
+   * @note A minimum of one Data packet is always returned, even if the file is empty.
+   */
+  [[nodiscard]] std::vector<std::shared_ptr<Data>>
+  segmentFile(const std::string& filename,
+              const Name& dataName,
+              size_t maxSegmentSize,
+              time::milliseconds freshnessPeriod,
+              uint32_t contentType = tlv::ContentType_Blob);
+
+  /**
+   * @brief Splits a blob of bytes into segments that are authenticated by a signed manifest.
+   *
+   * The segments are signed with DigestSha256 only. Their implicit digests, concatenated in
+   * segment order, form a manifest that is segmented under `<dataName>/32=manifest`. If the
+   * manifest needs more than one segment, its segments are in turn signed with DigestSha256 and
+   * covered by a manifest one level up, until the topmost manifest fits in a single segment.
+   * Only that segment is signed as specified by the SigningInfo given to the constructor, so
+   * the number of asymmetric signatures does not depend on the size of the object.
+   *
+   * Consumers can verify such segments with SegmentFetcher::Options::useManifest.
+   *
+   * @param buffer Contiguous range of bytes to divide into segments.
+   * @param dataName Name prefix to use for the Data packets. A segment number will be appended to it.
+   * @param maxSegmentSize Maximum size of the `Content` element (payload) of each created Data packet.
+   * @param freshnessPeriod The `FreshnessPeriod` of created Data packets.
+   * @param contentType The `ContentType` of created Data packets, except manifests.
+   * @return The segments of the object, followed by the segments of all manifests.
+   * @throw std::invalid_argument @p maxSegmentSize is less than twice the size of a digest
+   */
+  [[nodiscard]] std::vector<std::shared_ptr<Data>>
+  segmentWithManifest(span<const uint8_t> buffer,
+                      const Name& dataName,
+                      size_t maxSegmentSize,
+                      time::milliseconds freshnessPeriod,
+                      uint32_t contentType = tlv::ContentType_Blob);
+
+  /**
+   * @brief Returns the name component that is appended to the name prefix of an object
+   *        to form the name prefix of its manifest.
+   */
+  static name::Component
+  getManifestComponent();
+
+private:
+  std::vector<std::shared_ptr<Data>>
+  segmentImpl(span<const uint8_t> buffer, const Name& dataName, size_t maxSegmentSize,
+              time::milliseconds freshnessPeriod, uint32_t contentType,
+              const security::SigningInfo& signingInfo);
+
 private:
   KeyChain& m_keyChain;
   security::SigningInfo m_signingInfo;
@@ -0,0 +1,190 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx InMemoryStorage Hit Ratio Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/ims/in-memory-storage-arc.hpp"
+#include "ndn-cxx/ims/in-memory-storage-fifo.hpp"
+#include "ndn-cxx/ims/in-memory-storage-lfu.hpp"
+#include "ndn-cxx/ims/in-memory-storage-lru.hpp"
+#include "ndn-cxx/ims/in-memory-storage-tinylfu.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/core/demangle.hpp>
+#include <boost/mp11/list.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+namespace ndn::tests {
+
+// Each trace is a sequence of requested names. On every request, the storage is looked up,
+// and upon a miss the Data is inserted, as a producer-side cache would do.
+
+using Trace = std::vector<Name>;
+
+const size_t CACHE_SIZE = 1000;
+const size_t N_REQUESTS = 200000;
+const size_t N_KEYS = 20000;
+
+static Name
+makeName(const std::string& prefix, size_t key)
+{
+  return Name(prefix).appendNumber(key);
+}
+
+// requests following a Zipf distribution with exponent alpha
+static Trace
+makeZipfTrace(double alpha, size_t nRequests, std::mt19937& rng)
+{
+  std::vector<double> cdf(N_KEYS);
+  double sum = 0.0;
+  for (size_t i = 0; i < N_KEYS; ++i) {
+    sum += 1.0 / std::pow(static_cast<double>(i + 1), alpha);
+    cdf[i] = sum;
+  }
+
+  std::uniform_real_distribution<double> dist(0.0, sum);
+  Trace trace;
+  trace.reserve(nRequests);
+  for (size_t i = 0; i < nRequests; ++i) {
+    auto key = std::lower_bound(cdf.begin(), cdf.end(), dist(rng)) - cdf.begin();
+    trace.push_back(makeName("/zipf", static_cast<size_t>(key)));
+  }
+  return trace;
+}
+
+// Zipf requests interleaved with sequential scans of names that are requested only once
+static Trace
+makeZipfScanTrace(std::mt19937& rng)
+{
+  const size_t scanInterval = 10000;
+  const size_t scanLength = 2 * CACHE_SIZE;
+
+  Trace zipf = makeZipfTrace(0.9, N_REQUESTS, rng);
+  Trace trace;
+  size_t nScanned = 0;
+  for (size_t i = 0; i < zipf.size(); ++i) {
+    if (i % scanInterval == 0) {
+      for (size_t j = 0; j < scanLength; ++j) {
+        trace.push_back(makeName("/scan", nScanned++));
+      }
+    }
+    trace.push_back(zipf[i]);
+  }
+  return trace;
+}
+
+// a loop over slightly more names than the cache can hold
+static Trace
+makeLoopTrace()
+{
+  const size_t loopLength = CACHE_SIZE + CACHE_SIZE / 5;
+
+  Trace trace;
+  for (size_t i = 0; i < N_REQUESTS; ++i) {
+    trace.push_back(makeName("/loop", i % loopLength));
+  }
+  return trace;
+}
+
+// one name per line, from the file specified in NDN_CXX_IMS_TRACE environment variable
+static Trace
+loadTraceFile(const char* filename)
+{
+  Trace trace;
+  std::ifstream is(filename);
+  std::string line;
+  while (std::getline(is, line)) {
+    if (!line.empty()) {
+      trace.emplace_back(line);
+    }
+  }
+  return trace;
+}
+
+static const std::vector<std::pair<std::string, Trace>>&
+getTraces()
+{
+  static const auto traces = [] {
+    std::mt19937 rng(42);
+    std::vector<std::pair<std::string, Trace>> traces;
+    traces.emplace_back("zipf-0.8", makeZipfTrace(0.8, N_REQUESTS, rng));
+    traces.emplace_back("zipf-1.0", makeZipfTrace(1.0, N_REQUESTS, rng));
+    traces.emplace_back("zipf+scan", makeZipfScanTrace(rng));
+    traces.emplace_back("loop", makeLoopTrace());
+    if (const char* filename = std::getenv("NDN_CXX_IMS_TRACE"); filename != nullptr) {
+      traces.emplace_back(filename, loadTraceFile(filename));
+    }
+    return traces;
+  }();
+  return traces;
+}
+
+static shared_ptr<Data>
+makeData(const Name& name)
+{
+  auto data = make_shared<Data>(name);
+  data->setContent(std::vector<uint8_t>(1024));
+  data->setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+  data->setSignatureValue(std::make_shared<Buffer>(32));
+  data->wireEncode();
+  return data;
+}
+
+using Policies = boost::mp11::mp_list<InMemoryStorageFifo,
+                                      InMemoryStorageLru,
+                                      InMemoryStorageLfu,
+                                      InMemoryStorageArc,
+                                      InMemoryStorageTinyLfu>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(HitRatio, Policy, Policies)
+{
+  for (const auto& [traceName, trace] : getTraces()) {
+    Policy ims(CACHE_SIZE);
+    size_t nHits = 0;
+
+    auto d = timedExecute([&] {
+      for (const auto& name : trace) {
+        if (ims.find(name) != nullptr) {
+          ++nHits;
+        }
+        else {
+          ims.insert(*makeData(name));
+        }
+      }
+    });
+
+    BOOST_CHECK_LE(ims.size(), CACHE_SIZE);
+    std::cout << std::left << std::setw(24) << boost::core::demangle(typeid(Policy).name())
+              << std::setw(12) << traceName
+              << " hit ratio " << std::fixed << std::setprecision(4)
+              << static_cast<double>(nHits) / static_cast<double>(trace.size())
+              << " (" << trace.size() << " requests, " << d << ")" << std::endl;
+  }
+}
+
+} // namespace ndn::tests
@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx PacketTracer Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/util/packet-tracer.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn::tests {
+
+using ndn::util::PacketTraceEvent;
+using ndn::util::PacketTracer;
+
+BOOST_AUTO_TEST_CASE(Record)
+{
+  const Name name("/ndn/edu/ucla/ping/123456789/%FD%00%00%01%8A%B3%C2%1F%E0/seg=42");
+  const size_t nEvents = 10000000;
+
+  PacketTracer::disable();
+  auto d1 = timedExecute([&] {
+    for (size_t i = 0; i < nEvents; ++i) {
+      PacketTracer::record(PacketTraceEvent::IN_DATA, name, 1200, i);
+    }
+  });
+
+  PacketTracer::enable();
+  auto d2 = timedExecute([&] {
+    for (size_t i = 0; i < nEvents; ++i) {
+      PacketTracer::record(PacketTraceEvent::IN_DATA, name, 1200, i);
+    }
+  });
+
+  auto d3 = timedExecute([&] {
+    for (size_t i = 0; i < nEvents; ++i) {
+      PacketTracer::record(PacketTraceEvent::TRANSPORT_RECV, 1200);
+    }
+  });
+  PacketTracer::disable();
+
+  BOOST_CHECK_EQUAL(PacketTracer::snapshot().size(), 65536);
+
+  std::cout << "record " << nEvents << " events while disabled: " << d1
+            << " (" << d1 / nEvents << " per event)" << std::endl;
+  std::cout << "record " << nEvents << " named events: " << d2
+            << " (" << d2 / nEvents << " per event)" << std::endl;
+  std::cout << "record " << nEvents << " unnamed events: " << d3
+            << " (" << d3 / nEvents << " per event)" << std::endl;
+}
+
+} // namespace ndn::tests
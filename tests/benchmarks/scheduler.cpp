@@ -26,6 +26,8 @@
 #include "tests/benchmarks/timed-execute.hpp"
 
 #include <boost/asio/io_context.hpp>
+
+#include <array>
 #include <iostream>
 
 namespace ndn::tests {
@@ -54,6 +56,60 @@ BOOST_AUTO_TEST_CASE(ScheduleCancel)
   std::cout << "cancel " << nEvents << " events: " << d2 << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(ScheduleCancelLargeCapture)
+{
+  boost::asio::io_context io;
+  Scheduler sched(io);
+
+  const size_t nEvents = 1000000;
+  std::vector<scheduler::EventId> eventIds(nEvents);
+  // 40 octets of captures: too large for the small-object buffer of std::function
+  // in common standard library implementations, but still stored inline by schedule()
+  std::array<uint64_t, 4> payload{};
+  size_t* counter = nullptr;
+
+  auto d1 = timedExecute([&] {
+    for (size_t i = 0; i < nEvents; ++i) {
+      eventIds[i] = sched.schedule(1_s, [payload, counter] { *counter += payload[0]; });
+    }
+  });
+
+  auto d2 = timedExecute([&] {
+    for (size_t i = 0; i < nEvents; ++i) {
+      eventIds[i].cancel();
+    }
+  });
+
+  std::cout << "schedule " << nEvents << " events with large captures: " << d1 << std::endl;
+  std::cout << "cancel " << nEvents << " events with large captures: " << d2 << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(RescheduleSteadyState)
+{
+  boost::asio::io_context io;
+  Scheduler sched(io);
+
+  // a typical pattern of timeout events: each event is canceled and immediately replaced,
+  // so the number of pending events stays constant and event nodes are recycled
+  const size_t nPending = 10000;
+  const size_t nRounds = 100;
+  std::vector<scheduler::EventId> eventIds(nPending);
+  for (size_t i = 0; i < nPending; ++i) {
+    eventIds[i] = sched.schedule(1_s, []{});
+  }
+
+  auto d = timedExecute([&] {
+    for (size_t r = 0; r < nRounds; ++r) {
+      for (size_t i = 0; i < nPending; ++i) {
+        eventIds[i].cancel();
+        eventIds[i] = sched.schedule(1_s, []{});
+      }
+    }
+  });
+
+  std::cout << "cancel and reschedule " << nPending * nRounds << " events: " << d << std::endl;
+}
+
 BOOST_AUTO_TEST_CASE(Execute)
 {
   boost::asio::io_context io;
@@ -82,4 +138,32 @@ BOOST_AUTO_TEST_CASE(Execute)
   std::cout << "execute " << nEvents << " events: " << (t2 - t1) << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(ExecuteStaggered)
+{
+  const size_t nEvents = 100000;
+
+  for (time::nanoseconds slack : {0_ns, time::nanoseconds(1_ms)}) {
+    boost::asio::io_context io;
+    Scheduler sched(io);
+    sched.setTimerSlack(slack);
+
+    // events expire every 10us over a period of 1s
+    size_t nExpired = 0;
+    for (size_t i = 0; i < nEvents; ++i) {
+      sched.schedule(time::microseconds(10 * i), [&] { ++nExpired; });
+    }
+
+    size_t nWakeUps = 0;
+    auto d = timedExecute([&] {
+      while (io.run_one() > 0) {
+        ++nWakeUps;
+      }
+    });
+
+    BOOST_REQUIRE_EQUAL(nExpired, nEvents);
+    std::cout << "execute " << nEvents << " staggered events with " << slack << " slack: "
+              << d << ", " << nWakeUps << " handlers invoked" << std::endl;
+  }
+}
+
 } // namespace ndn::tests
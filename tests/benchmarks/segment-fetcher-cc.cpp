@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx SegmentFetcher Congestion Control Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/validator-null.hpp"
+#include "ndn-cxx/util/segment-fetcher.hpp"
+#include "tests/benchmarks/simulated-link.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn::tests {
+
+using util::CongestionControlAlgorithm;
+
+const size_t SEGMENT_SIZE = 8000;
+const time::nanoseconds TICK = 100_us;
+const time::nanoseconds TIME_LIMIT = 300_s;
+
+struct Scenario
+{
+  std::string name;
+  SimulatedLink::Options link;
+  size_t nSegments = 2500;
+};
+
+static std::vector<Scenario>
+getScenarios()
+{
+  std::vector<Scenario> scenarios;
+
+  Scenario lan{"lan", {}};
+  lan.link.rtt = 2_ms;
+  lan.link.bandwidth = 100e6 / 8;
+  scenarios.push_back(lan);
+
+  Scenario wan{"wan", {}};
+  wan.link.rtt = 50_ms;
+  wan.link.bandwidth = 50e6 / 8;
+  wan.link.lossRate = 0.001;
+  scenarios.push_back(wan);
+
+  Scenario lfn{"long-fat", {}};
+  lfn.link.rtt = 200_ms;
+  lfn.link.bandwidth = 200e6 / 8;
+  lfn.link.queueCapacity = 4 * 1024 * 1024;
+  lfn.link.lossRate = 0.0001;
+  // the bandwidth-delay product is about 600 segments, and the object must be large enough for
+  // the fetch to continue well past slow start
+  lfn.nSegments = 25000;
+  scenarios.push_back(lfn);
+
+  Scenario lossy{"lossy", {}};
+  lossy.link.rtt = 80_ms;
+  lossy.link.bandwidth = 20e6 / 8;
+  lossy.link.lossRate = 0.01;
+  scenarios.push_back(lossy);
+
+  return scenarios;
+}
+
+static std::vector<shared_ptr<const Data>>
+makeObject(const Name& versionedName, size_t nSegments)
+{
+  std::vector<shared_ptr<const Data>> segments;
+  for (size_t i = 0; i < nSegments; ++i) {
+    auto data = make_shared<Data>(Name(versionedName).appendSegment(i));
+    data->setFreshnessPeriod(1_s);
+    data->setFinalBlock(name::Component::fromSegment(nSegments - 1));
+    data->setContent(std::vector<uint8_t>(SEGMENT_SIZE));
+    data->setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+    data->setSignatureValue(std::make_shared<Buffer>(32));
+    data->wireEncode();
+    segments.push_back(std::move(data));
+  }
+  return segments;
+}
+
+BOOST_AUTO_TEST_CASE(FetchOverSimulatedLink)
+{
+  const Name prefix("/bench/object");
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+
+  for (const auto& scenario : getScenarios()) {
+    const auto segments = makeObject(Name(prefix).appendVersion(1), scenario.nSegments);
+    for (auto algorithm : {CongestionControlAlgorithm::AIMD,
+                           CongestionControlAlgorithm::CUBIC,
+                           CongestionControlAlgorithm::BBR}) {
+      SimulatedTime simTime;
+      boost::asio::io_context io;
+      DummyClientFace face(io, keyChain, {false, false});
+      SimulatedLink link(face, [&] (const Interest& interest) -> shared_ptr<const Data> {
+        const auto& last = interest.getName().at(-1);
+        return segments.at(last.isSegment() ? last.toSegment() : 0);
+      }, scenario.link);
+
+      SegmentFetcher::Options options;
+      options.congestionControl = algorithm;
+      auto fetcher = SegmentFetcher::start(face, Interest(prefix), security::getAcceptAllValidator(),
+                                           options);
+      bool isDone = false;
+      size_t nBytes = 0;
+      fetcher->onComplete.connect([&] (ConstBufferPtr content) {
+        isDone = true;
+        nBytes = content->size();
+      });
+      fetcher->onError.connect([&] (uint32_t, const std::string& msg) {
+        isDone = true;
+        BOOST_ERROR(scenario.name << " " << algorithm << ": " << msg);
+      });
+
+      auto start = time::steady_clock::now();
+      while (!isDone && time::steady_clock::now() - start < TIME_LIMIT) {
+        simTime.advance(io, TICK);
+      }
+      // time::steady_clock is simulated, so the processing time is measured with the CPU clock
+      auto cpuSeconds = simTime.getCpuTime();
+      auto elapsed = time::steady_clock::now() - start;
+      BOOST_CHECK_EQUAL(nBytes, SEGMENT_SIZE * scenario.nSegments);
+
+      double seconds = static_cast<double>(elapsed.count()) / 1e9;
+      std::cout << std::left << std::setw(10) << scenario.name << std::setw(6) << algorithm
+                << std::fixed << std::setprecision(3)
+                << " completion " << seconds << "s"
+                << " goodput " << std::setprecision(1) << nBytes * 8 / seconds / 1e6 << " Mbps"
+                << " (" << std::setprecision(1) << scenario.link.bandwidth * 8 / 1e6 << " Mbps link)"
+                << " retx " << link.getNRetransmissions()
+                << " drops " << link.getNDrops()
+                << " cpu " << std::setprecision(0) << cpuSeconds * 1e3 << "ms"
+                << std::endl;
+    }
+  }
+}
+
+} // namespace ndn::tests
@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx SegmentFetcher Throughput Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/security/validator-null.hpp"
+#include "ndn-cxx/util/segment-fetcher.hpp"
+#include "ndn-cxx/util/segmenter.hpp"
+#include "tests/benchmarks/simulated-link.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn::tests {
+
+const size_t SEGMENT_SIZE = 8000;
+const size_t OBJECT_SIZE = 20 * 1000 * 1000;
+const time::nanoseconds TICK = 100_us;
+const time::nanoseconds TIME_LIMIT = 300_s;
+
+struct Scenario
+{
+  std::string name;
+  SimulatedFaceLink::Options link;
+};
+
+static std::vector<Scenario>
+getScenarios()
+{
+  std::vector<Scenario> scenarios;
+
+  Scenario lan{"lan", {}};
+  lan.link.rtt = 2_ms;
+  lan.link.bandwidth = 100e6 / 8;
+  scenarios.push_back(lan);
+
+  Scenario wan{"wan", {}};
+  wan.link.rtt = 50_ms;
+  wan.link.bandwidth = 50e6 / 8;
+  wan.link.lossRate = 0.001;
+  scenarios.push_back(wan);
+
+  Scenario jittery{"jittery", {}};
+  jittery.link.rtt = 30_ms;
+  jittery.link.jitter = 10_ms;
+  jittery.link.bandwidth = 50e6 / 8;
+  scenarios.push_back(jittery);
+
+  Scenario lossy{"lossy", {}};
+  lossy.link.rtt = 80_ms;
+  lossy.link.bandwidth = 20e6 / 8;
+  lossy.link.lossRate = 0.01;
+  scenarios.push_back(lossy);
+
+  return scenarios;
+}
+
+/**
+ * \brief Measures the end-to-end retrieval of an object over a simulated link.
+ *
+ * The producer serves the output of Segmenter from its own DummyClientFace, so that every
+ * packet is encoded, decoded, and dispatched by both faces, as it would be over a real link.
+ * Goodput is computed over simulated time. The CPU time covers both endpoints and the simulated
+ * link, but only in the clock ticks where some event was due, so that a fetch that stalls on a
+ * timer does not appear more expensive for the idle time it spends waiting.
+ */
+BOOST_AUTO_TEST_CASE(FetchOverSimulatedLink)
+{
+  const Name prefix("/bench/object");
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  Segmenter segmenter(keyChain, security::signingWithSha256());
+  const auto segments = segmenter.segment(std::vector<uint8_t>(OBJECT_SIZE),
+                                          Name(prefix).appendVersion(1), SEGMENT_SIZE, 1_s);
+
+  for (bool inOrder : {false, true}) {
+    for (const auto& scenario : getScenarios()) {
+      SimulatedTime simTime;
+      boost::asio::io_context io;
+      DummyClientFace consumer(io, keyChain, {false, false});
+      DummyClientFace producer(io, keyChain, {false, false});
+      SimulatedFaceLink link(consumer, producer, scenario.link);
+
+      producer.setInterestFilter(prefix, [&] (const auto&, const Interest& interest) {
+        const auto& last = interest.getName().at(-1);
+        auto segment = last.isSegment() ? last.toSegment() : 0;
+        if (segment < segments.size()) {
+          producer.put(*segments[segment]);
+        }
+      });
+
+      SegmentFetcher::Options options;
+      options.inOrder = inOrder;
+      auto fetcher = SegmentFetcher::start(consumer, Interest(prefix),
+                                           security::getAcceptAllValidator(), options);
+      bool isDone = false;
+      size_t nBytes = 0;
+      fetcher->onComplete.connect([&] (ConstBufferPtr content) {
+        isDone = true;
+        nBytes = content->size();
+      });
+      fetcher->onInOrderData.connect([&] (ConstBufferPtr content) { nBytes += content->size(); });
+      fetcher->onInOrderComplete.connect([&] { isDone = true; });
+      fetcher->onError.connect([&] (uint32_t, const std::string& msg) {
+        isDone = true;
+        BOOST_ERROR(scenario.name << ": " << msg);
+      });
+
+      auto start = time::steady_clock::now();
+      while (!isDone && time::steady_clock::now() - start < TIME_LIMIT) {
+        simTime.advance(io, TICK);
+      }
+      // time::steady_clock is simulated, so the processing time is measured with the CPU clock
+      auto cpuSeconds = simTime.getCpuTime();
+      auto elapsed = time::steady_clock::now() - start;
+      BOOST_CHECK_EQUAL(nBytes, OBJECT_SIZE);
+
+      double seconds = static_cast<double>(elapsed.count()) / 1e9;
+      double megabytes = static_cast<double>(nBytes) / 1e6;
+      std::cout << std::left << std::setw(8) << scenario.name
+                << std::setw(9) << (inOrder ? "in-order" : "block")
+                << std::fixed << std::setprecision(1)
+                << " goodput " << std::setw(6) << std::right << nBytes * 8 / seconds / 1e6 << " Mbps"
+                << " (" << scenario.link.bandwidth * 8 / 1e6 << " Mbps link)"
+                << " cpu " << std::setprecision(2) << cpuSeconds * 1e3 / megabytes << " ms/MB"
+                << " retx " << std::setprecision(2)
+                << 100.0 * link.getNRetransmissions() /
+                   std::max<size_t>(link.getNInterests() - link.getNRetransmissions(), 1) << "%"
+                << " drops " << link.getNDrops()
+                << std::left << std::endl;
+    }
+  }
+}
+
+} // namespace ndn::tests
@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx SegmentFetcher Window Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/lp/nack.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/validator-null.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+#include "ndn-cxx/util/segment-fetcher.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/asio/io_context.hpp>
+
+#include <iomanip>
+#include <iostream>
+
+namespace ndn::tests {
+
+const size_t N_SEGMENTS = 200000;
+const size_t N_REPEATS = 3;
+
+static std::vector<shared_ptr<const Data>>
+makeObject(const Name& versionedName)
+{
+  std::vector<shared_ptr<const Data>> segments;
+  segments.reserve(N_SEGMENTS);
+  for (size_t i = 0; i < N_SEGMENTS; ++i) {
+    auto data = make_shared<Data>(Name(versionedName).appendSegment(i));
+    data->setFreshnessPeriod(1_s);
+    data->setFinalBlock(name::Component::fromSegment(N_SEGMENTS - 1));
+    data->setContent(std::vector<uint8_t>(100));
+    data->setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+    data->setSignatureValue(std::make_shared<Buffer>(32));
+    data->wireEncode();
+    segments.push_back(std::move(data));
+  }
+  return segments;
+}
+
+/**
+ * \brief Measures the processing time of SegmentFetcher per retrieved segment.
+ *
+ * Segments are served instantly by the DummyClientFace, so that the measured time is spent in
+ * SegmentFetcher and Face, with the window kept full. Every \p nackInterval -th Interest is
+ * answered with a congestion Nack, which exercises retransmissions.
+ */
+static void
+fetch(const std::vector<shared_ptr<const Data>>& segments, const Name& prefix,
+      double cwnd, size_t nackInterval)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  time::nanoseconds best = time::nanoseconds::max();
+
+  for (size_t repeat = 0; repeat < N_REPEATS; ++repeat) {
+    boost::asio::io_context io;
+    DummyClientFace face(io, keyChain, {false, false});
+    size_t nInterests = 0;
+    face.onSendInterest.connect([&] (const Interest& interest) {
+      ++nInterests;
+      if (nackInterval > 0 && nInterests % nackInterval == 0) {
+        face.receive(lp::Nack(interest).setReason(lp::NackReason::CONGESTION));
+        return;
+      }
+      const auto& last = interest.getName().at(-1);
+      face.receive(*segments.at(last.isSegment() ? last.toSegment() : 0));
+    });
+
+    SegmentFetcher::Options options;
+    options.useConstantCwnd = true;
+    options.initCwnd = cwnd;
+    options.probeLatestVersion = false;
+    size_t nBytes = 0;
+
+    auto duration = timedExecute([&] {
+      auto fetcher = SegmentFetcher::start(face, Interest(prefix), security::getAcceptAllValidator(),
+                                           options);
+      fetcher->onComplete.connect([&] (ConstBufferPtr content) { nBytes = content->size(); });
+      fetcher->onError.connect([] (uint32_t, const std::string& msg) { BOOST_ERROR(msg); });
+      io.run();
+    });
+    BOOST_CHECK_EQUAL(nBytes, N_SEGMENTS * 100);
+    best = std::min(best, duration);
+  }
+
+  std::cout << "cwnd " << std::setw(5) << cwnd
+            << " nack 1/" << std::setw(5) << std::left << nackInterval << std::right
+            << std::fixed << std::setprecision(0)
+            << " " << std::setw(6) << static_cast<double>(best.count()) / N_SEGMENTS << " ns/segment"
+            << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(CpuPerSegment)
+{
+  const Name prefix = Name("/bench/object").appendVersion(1);
+  const auto segments = makeObject(prefix);
+
+  for (double cwnd : {1.0, 16.0, 256.0, 4096.0}) {
+    fetch(segments, prefix, cwnd, 0);
+  }
+  for (double cwnd : {16.0, 256.0, 4096.0}) {
+    fetch(segments, prefix, cwnd, 100);
+  }
+}
+
+} // namespace ndn::tests
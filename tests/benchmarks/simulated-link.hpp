@@ -0,0 +1,261 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_TESTS_BENCHMARKS_SIMULATED_LINK_HPP
+#define NDN_CXX_TESTS_BENCHMARKS_SIMULATED_LINK_HPP
+
+#include "ndn-cxx/util/dummy-client-face.hpp"
+#include "ndn-cxx/util/scheduler.hpp"
+#include "ndn-cxx/util/signal/scoped-connection.hpp"
+#include "ndn-cxx/util/time-unit-test-clock.hpp"
+
+#include <boost/asio/io_context.hpp>
+
+#include <ctime>
+#include <random>
+#include <set>
+
+namespace ndn::tests {
+
+/**
+ * \brief Replaces the library clocks with manually advanced clocks for its lifetime.
+ */
+class SimulatedTime : noncopyable
+{
+public:
+  SimulatedTime()
+    : m_steadyClock(make_shared<time::UnitTestSteadyClock>())
+  {
+    time::setCustomClocks(m_steadyClock, make_shared<time::UnitTestSystemClock>());
+  }
+
+  ~SimulatedTime()
+  {
+    time::setCustomClocks(nullptr, nullptr);
+  }
+
+  /**
+   * \brief Advance the clock by \p tick and process the events that became due.
+   */
+  void
+  advance(boost::asio::io_context& io, time::nanoseconds tick)
+  {
+    m_steadyClock->advance(tick);
+    io.restart();
+    auto cpuStart = std::clock();
+    if (io.poll() > 0) {
+      m_cpuTime += std::clock() - cpuStart;
+    }
+  }
+
+  /**
+   * \brief Return the CPU time, in seconds, spent in the handlers run by advance().
+   *
+   * Ticks in which no handler was due are not counted, so the result does not grow with the
+   * simulated duration of an idle link.
+   */
+  double
+  getCpuTime() const
+  {
+    return static_cast<double>(m_cpuTime) / CLOCKS_PER_SEC;
+  }
+
+private:
+  shared_ptr<time::UnitTestSteadyClock> m_steadyClock;
+  std::clock_t m_cpuTime = 0;
+};
+
+/**
+ * \brief Common part of the simulated links: bottleneck queues, random loss, and jitter.
+ */
+class SimulatedLinkBase : noncopyable
+{
+public:
+  struct Options
+  {
+    time::nanoseconds rtt = 20_ms;     ///< propagation round-trip delay
+    time::nanoseconds jitter = 0_ns;   ///< maximum random delay added to each packet
+    double bandwidth = 10e6;           ///< bottleneck bandwidth, in bytes per second
+    size_t queueCapacity = 256 * 1024; ///< bottleneck queue capacity, in bytes
+    double lossRate = 0.0;             ///< probability that a packet is lost
+    uint32_t seed = 1;
+  };
+
+  /**
+   * \brief Returns the number of Interests sent by the consumer.
+   */
+  size_t
+  getNInterests() const
+  {
+    return m_nInterests;
+  }
+
+  /**
+   * \brief Returns the number of Interests whose name had already been sent by the consumer.
+   */
+  size_t
+  getNRetransmissions() const
+  {
+    return m_nInterests - m_sentNames.size();
+  }
+
+  /**
+   * \brief Returns the number of packets lost.
+   */
+  size_t
+  getNDrops() const
+  {
+    return m_nDrops;
+  }
+
+protected:
+  SimulatedLinkBase(boost::asio::io_context& io, const Options& options)
+    : m_options(options)
+    , m_scheduler(io)
+    , m_rng(options.seed)
+  {
+  }
+
+  void
+  countInterest(const Interest& interest)
+  {
+    ++m_nInterests;
+    m_sentNames.insert(interest.getName());
+  }
+
+  /**
+   * \brief Sends a packet of \p size octets through one direction of the link.
+   * \param linkFreeAt when the bottleneck of that direction finishes its current backlog
+   * \param arrivalDelay delay before the packet reaches the bottleneck
+   * \param deliver invoked when the packet reaches the other end, i.e., after its transmission,
+   *                half of the RTT, and a random jitter; not invoked if the packet is lost
+   */
+  void
+  transmit(time::steady_clock::time_point& linkFreeAt, time::nanoseconds arrivalDelay,
+           size_t size, std::function<void()> deliver)
+  {
+    auto now = time::steady_clock::now();
+    auto arrival = now + arrivalDelay;
+    auto txStart = std::max(arrival, linkFreeAt);
+    auto backlog = static_cast<double>((txStart - arrival).count()) / 1e9 * m_options.bandwidth;
+    if (backlog > static_cast<double>(m_options.queueCapacity) ||
+        std::bernoulli_distribution(m_options.lossRate)(m_rng)) {
+      ++m_nDrops;
+      return;
+    }
+
+    auto txTime = time::nanoseconds(static_cast<int64_t>(size / m_options.bandwidth * 1e9));
+    linkFreeAt = txStart + txTime;
+
+    auto delivery = linkFreeAt + m_options.rtt / 2;
+    if (m_options.jitter > 0_ns) {
+      delivery += time::nanoseconds(std::uniform_int_distribution<int64_t>(
+                                      0, m_options.jitter.count())(m_rng));
+    }
+    m_scheduler.schedule(delivery - now, std::move(deliver));
+  }
+
+protected:
+  const Options m_options;
+
+private:
+  Scheduler m_scheduler;
+  std::mt19937 m_rng;
+  std::set<Name> m_sentNames;
+  size_t m_nInterests = 0;
+  size_t m_nDrops = 0;
+};
+
+/**
+ * \brief Emulates the network path between a consumer DummyClientFace and a producer.
+ *
+ * Every Interest sent by the face is answered by the producer callback. The returned Data
+ * crosses a bottleneck link with a drop-tail queue, may be lost at random, and reaches the
+ * face after the propagation delay plus a random jitter. Interests are never lost.
+ */
+class SimulatedLink : public SimulatedLinkBase
+{
+public:
+  using Producer = std::function<shared_ptr<const Data>(const Interest&)>;
+
+  SimulatedLink(DummyClientFace& face, Producer producer, const Options& options)
+    : SimulatedLinkBase(face.getIoContext(), options)
+    , m_face(face)
+    , m_producer(std::move(producer))
+    , m_linkFreeAt(time::steady_clock::now())
+  {
+    m_conn = m_face.onSendInterest.connect([this] (const Interest& interest) {
+      countInterest(interest);
+      auto data = m_producer(interest);
+      if (data == nullptr) {
+        return;
+      }
+      // the Data arrives at the bottleneck after half of the RTT, and waits for its transmission
+      transmit(m_linkFreeAt, m_options.rtt / 2, data->wireEncode().size(),
+               [this, data] { m_face.receive(*data); });
+    });
+  }
+
+private:
+  DummyClientFace& m_face;
+  Producer m_producer;
+  time::steady_clock::time_point m_linkFreeAt;
+  signal::ScopedConnection m_conn;
+};
+
+/**
+ * \brief Emulates a point-to-point link between a consumer and a producer DummyClientFace.
+ *
+ * Unlike DummyClientFace::linkTo(), which delivers packets instantly, each direction of the
+ * link has its own drop-tail queue at the given bandwidth, and packets in either direction may
+ * be lost at random and are delayed by half of the RTT plus a random jitter. Jitter may reorder
+ * packets.
+ */
+class SimulatedFaceLink : public SimulatedLinkBase
+{
+public:
+  SimulatedFaceLink(DummyClientFace& consumer, DummyClientFace& producer, const Options& options)
+    : SimulatedLinkBase(consumer.getIoContext(), options)
+    , m_upstreamFreeAt(time::steady_clock::now())
+    , m_downstreamFreeAt(time::steady_clock::now())
+  {
+    m_conns[0] = consumer.onSendInterest.connect([this, &producer] (const Interest& interest) {
+      countInterest(interest);
+      transmit(m_upstreamFreeAt, 0_ns, interest.wireEncode().size(), [&producer, interest] {
+        producer.receive(interest);
+      });
+    });
+    m_conns[1] = producer.onSendData.connect([this, &consumer] (const Data& data) {
+      transmit(m_downstreamFreeAt, 0_ns, data.wireEncode().size(), [&consumer, data] {
+        consumer.receive(data);
+      });
+    });
+  }
+
+private:
+  time::steady_clock::time_point m_upstreamFreeAt;
+  time::steady_clock::time_point m_downstreamFreeAt;
+  signal::ScopedConnection m_conns[2];
+};
+
+} // namespace ndn::tests
+
+#endif // NDN_CXX_TESTS_BENCHMARKS_SIMULATED_LINK_HPP
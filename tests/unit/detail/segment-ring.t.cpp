@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/segment-ring.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <memory>
+
+namespace ndn::tests {
+
+using ndn::detail::SegmentRing;
+
+BOOST_AUTO_TEST_SUITE(Detail)
+BOOST_AUTO_TEST_SUITE(TestSegmentRing)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  SegmentRing<int> ring(4);
+  BOOST_TEST(ring.empty());
+  BOOST_TEST(ring.capacity() == 4);
+  BOOST_TEST(ring.find(0) == nullptr);
+
+  auto [entry, isNew] = ring.tryEmplace(1, 10);
+  BOOST_TEST(isNew);
+  BOOST_TEST(*entry == 10);
+  BOOST_TEST(ring.size() == 1);
+  BOOST_TEST(ring.getBegin() == 1);
+  BOOST_TEST(ring.getEnd() == 2);
+
+  std::tie(entry, isNew) = ring.tryEmplace(1, 11);
+  BOOST_TEST(!isNew);
+  BOOST_TEST(*entry == 10);
+
+  ring.tryEmplace(3, 30);
+  BOOST_TEST(ring.size() == 2);
+  BOOST_TEST(ring.find(2) == nullptr);
+  BOOST_REQUIRE(ring.find(3) != nullptr);
+  BOOST_TEST(*ring.find(3) == 30);
+  BOOST_TEST(ring.find(4) == nullptr);
+
+  ring.erase(1);
+  ring.erase(2);
+  BOOST_TEST(ring.size() == 1);
+  BOOST_TEST(ring.find(1) == nullptr);
+
+  ring.trimFront();
+  BOOST_TEST(ring.getBegin() == 3);
+  BOOST_TEST(ring.getEnd() == 4);
+
+  // slots are reused as the range slides forward
+  ring.tryEmplace(6, 60);
+  BOOST_TEST(ring.capacity() == 4);
+  BOOST_TEST(*ring.find(3) == 30);
+  BOOST_TEST(*ring.find(6) == 60);
+  BOOST_TEST(ring.find(2) == nullptr); // same slot as 6, but outside the range
+
+  ring.popFront();
+  BOOST_TEST(ring.getBegin() == 4);
+  BOOST_TEST(ring.size() == 1);
+
+  ring.clear();
+  BOOST_TEST(ring.empty());
+  BOOST_TEST(ring.find(6) == nullptr);
+  BOOST_TEST(ring.getBegin() == 7);
+}
+
+BOOST_AUTO_TEST_CASE(Grow)
+{
+  SegmentRing<std::unique_ptr<int>> ring(4);
+  for (int i = 0; i < 6; ++i) {
+    ring.tryEmplace(i, std::make_unique<int>(i));
+    if (i == 1) {
+      ring.erase(0);
+      ring.erase(1);
+      ring.trimFront();
+    }
+  }
+  BOOST_TEST(ring.capacity() == 4);
+  BOOST_TEST(ring.getBegin() == 2);
+
+  // beyond the end
+  ring.tryEmplace(9, std::make_unique<int>(9));
+  BOOST_TEST(ring.capacity() == 8);
+  BOOST_TEST(ring.size() == 5);
+  BOOST_TEST(ring.getBegin() == 2);
+  BOOST_TEST(ring.getEnd() == 10);
+
+  // before the beginning
+  ring.tryEmplace(0, std::make_unique<int>(0));
+  BOOST_TEST(ring.capacity() == 16);
+  BOOST_TEST(ring.getBegin() == 0);
+
+  for (int i : {0, 2, 3, 4, 5, 9}) {
+    BOOST_REQUIRE(ring.find(i) != nullptr);
+    BOOST_TEST(**ring.find(i) == i);
+  }
+  for (int i : {1, 6, 7, 8, 10}) {
+    BOOST_TEST(ring.find(i) == nullptr);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(RestartWhenEmpty)
+{
+  SegmentRing<int> ring(4);
+  ring.tryEmplace(uint64_t{1} << 40, 40);
+  BOOST_TEST(ring.capacity() == 4);
+  BOOST_TEST(ring.getBegin() == uint64_t{1} << 40);
+  BOOST_TEST(*ring.find(uint64_t{1} << 40) == 40);
+  BOOST_TEST(ring.find(0) == nullptr);
+
+  ring.popFront();
+  BOOST_TEST(ring.empty());
+  ring.tryEmplace(5, 5);
+  BOOST_TEST(ring.capacity() == 4);
+  BOOST_TEST(ring.getBegin() == 5);
+  BOOST_TEST(ring.getEnd() == 6);
+  BOOST_TEST(*ring.find(5) == 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSegmentRing
+BOOST_AUTO_TEST_SUITE_END() // Detail
+
+} // namespace ndn::tests
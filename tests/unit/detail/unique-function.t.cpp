@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/unique-function.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <array>
+#include <memory>
+
+namespace ndn::tests {
+
+using ndn::detail::UniqueFunction;
+
+BOOST_AUTO_TEST_SUITE(Detail)
+BOOST_AUTO_TEST_SUITE(TestUniqueFunction)
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  UniqueFunction<void()> f1;
+  BOOST_CHECK(!f1);
+  BOOST_CHECK(f1 == nullptr);
+  BOOST_CHECK_THROW(f1(), std::bad_function_call);
+
+  UniqueFunction<void()> f2 = nullptr;
+  BOOST_CHECK(!f2);
+
+  void (*fp)() = nullptr;
+  UniqueFunction<void()> f3 = fp;
+  BOOST_CHECK(!f3);
+
+  std::function<void()> sf;
+  UniqueFunction<void()> f4 = sf;
+  BOOST_CHECK(!f4);
+}
+
+BOOST_AUTO_TEST_CASE(InvokeAndMove)
+{
+  int sum = 0;
+  UniqueFunction<int(int)> f = [&sum] (int x) { sum += x; return sum; };
+  BOOST_CHECK(f != nullptr);
+  BOOST_CHECK_EQUAL(f(3), 3);
+
+  UniqueFunction<int(int)> g = std::move(f);
+  BOOST_CHECK(!f); // NOLINT(bugprone-use-after-move)
+  BOOST_CHECK_EQUAL(g(4), 7);
+
+  f = std::move(g);
+  BOOST_CHECK(!g); // NOLINT(bugprone-use-after-move)
+  BOOST_CHECK_EQUAL(f(1), 8);
+
+  f = nullptr;
+  BOOST_CHECK(!f);
+}
+
+BOOST_AUTO_TEST_CASE(MoveOnlyCapture)
+{
+  auto p = std::make_unique<int>(42);
+  UniqueFunction<int()> f = [p = std::move(p)] { return *p; };
+  BOOST_CHECK_EQUAL(f(), 42);
+
+  UniqueFunction<int()> g;
+  g = std::move(f);
+  BOOST_CHECK_EQUAL(g(), 42);
+}
+
+BOOST_AUTO_TEST_CASE(LargeCapture)
+{
+  std::array<uint64_t, 16> big{};
+  big.fill(2);
+  auto tracker = std::make_shared<int>(0);
+
+  UniqueFunction<uint64_t()> f = [big, tracker] {
+    uint64_t sum = 0;
+    for (auto x : big) {
+      sum += x;
+    }
+    return sum;
+  };
+  BOOST_CHECK_EQUAL(tracker.use_count(), 2);
+  BOOST_CHECK_EQUAL(f(), 32);
+
+  auto g = std::move(f);
+  BOOST_CHECK_EQUAL(tracker.use_count(), 2);
+  BOOST_CHECK_EQUAL(g(), 32);
+
+  g = nullptr;
+  BOOST_CHECK_EQUAL(tracker.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Destroy)
+{
+  auto tracker = std::make_shared<int>(0);
+  {
+    UniqueFunction<void()> f = [tracker] {};
+    BOOST_CHECK_EQUAL(tracker.use_count(), 2);
+    UniqueFunction<void()> g = std::move(f);
+    BOOST_CHECK_EQUAL(tracker.use_count(), 2);
+  }
+  BOOST_CHECK_EQUAL(tracker.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestUniqueFunction
+BOOST_AUTO_TEST_SUITE_END() // Detail
+
+} // namespace ndn::tests
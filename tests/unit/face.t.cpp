@@ -145,6 +145,30 @@ BOOST_AUTO_TEST_CASE(MultipleData)
   BOOST_CHECK_EQUAL(face.sentData.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(MoveOnlyCallbacks)
+{
+  auto token = std::make_unique<int>(1);
+  size_t nData = 0;
+  face.expressInterest(*makeInterest("/Hello/World", true, 50_ms),
+                       [&nData, token = std::move(token)] (auto&&...) { nData += *token; },
+                       [] (auto&&...) { BOOST_FAIL("Unexpected Nack"); },
+                       nullptr);
+
+  advanceClocks(10_ms);
+  face.receive(*makeData("/Hello/World/a"));
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(nData, 1);
+
+  // the std::function aliases remain copyable
+  size_t nTimeouts = 0;
+  TimeoutCallback onTimeout = [&] (const Interest&) { ++nTimeouts; };
+  TimeoutCallback onTimeoutCopy = onTimeout;
+  face.expressInterest(*makeInterest("/Hello/World/b", false, 50_ms),
+                       DataCallback(), NackCallback(), onTimeoutCopy);
+  advanceClocks(20_ms, 5);
+  BOOST_CHECK_EQUAL(nTimeouts, 1);
+}
+
 BOOST_AUTO_TEST_CASE(EmptyDataCallback)
 {
   face.expressInterest(*makeInterest("/Hello/World", true),
@@ -826,6 +850,58 @@ BOOST_AUTO_TEST_CASE(Handle)
 
 BOOST_AUTO_TEST_SUITE_END() // SetInterestFilter
 
+BOOST_AUTO_TEST_CASE(Counters)
+{
+  const auto& counters = face.getCounters();
+  BOOST_CHECK_EQUAL(counters.nOutInterests, 0);
+  BOOST_CHECK_EQUAL(counters.rtt.getCount(), 0);
+
+  face.expressInterest(*makeInterest("/A", false, 100_ms), nullptr, nullptr, nullptr);
+  face.expressInterest(*makeInterest("/B", false, 100_ms), nullptr, nullptr, nullptr);
+  face.expressInterest(*makeInterest("/C", false, 100_ms), nullptr, nullptr, nullptr);
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(counters.nOutInterests, 3);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 3);
+  BOOST_CHECK_GT(counters.nOutBytes, 0);
+
+  advanceClocks(10_ms, 2);
+  face.receive(*makeData("/A"));
+  face.receive(makeNack(face.sentInterests.at(1), lp::NackReason::NO_ROUTE));
+  BOOST_CHECK_EQUAL(counters.nInData, 1);
+  BOOST_CHECK_EQUAL(counters.nInNacks, 1);
+  BOOST_CHECK_EQUAL(counters.nSatisfiedInterests, 1);
+  BOOST_CHECK_EQUAL(counters.nNackedInterests, 1);
+  BOOST_CHECK_EQUAL(counters.nTimedOutInterests, 0);
+  BOOST_CHECK_EQUAL(counters.rtt.getCount(), 1);
+  BOOST_CHECK_EQUAL(counters.rtt.getSum(), 20_ms);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 1);
+
+  advanceClocks(50_ms, 2);
+  BOOST_CHECK_EQUAL(counters.nTimedOutInterests, 1);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
+
+  face.setInterestFilter("/P", [this] (const auto&, const Interest& interest) {
+    face.put(*makeData(interest.getName()));
+  });
+  advanceClocks(1_ms);
+  auto nOutBytes = counters.nOutBytes.get();
+  face.receive(*makeInterest("/P/1"));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(counters.nInInterests, 1);
+  BOOST_CHECK_EQUAL(counters.nOutData, 1);
+  BOOST_CHECK_EQUAL(counters.nOutBytes, nOutBytes + face.sentData.at(0).wireEncode().size());
+  BOOST_CHECK_GT(counters.nInBytes, 0);
+
+  face.setInterestFilter("/Q", nullptr);
+  advanceClocks(1_ms);
+  auto interest = makeInterest("/Q/1", false, std::nullopt, 42);
+  face.receive(*interest);
+  face.put(makeNack(*interest, lp::NackReason::NO_ROUTE));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(counters.nInInterests, 2);
+  BOOST_CHECK_EQUAL(counters.nOutNacks, 1);
+}
+
 BOOST_AUTO_TEST_CASE(ProcessEvents)
 {
   face.processEvents(-1_ms); // io_context::restart()/poll() inside
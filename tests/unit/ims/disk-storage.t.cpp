@@ -0,0 +1,174 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/disk-storage.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace ndn::tests {
+
+class DiskStorageFixture
+{
+protected:
+  ~DiskStorageFixture()
+  {
+    std::filesystem::remove_all(m_path);
+  }
+
+  static shared_ptr<Data>
+  makeLargeData(const Name& name, size_t contentSize)
+  {
+    auto data = make_shared<Data>(name);
+    data->setContent(std::vector<uint8_t>(contentSize, 0xBB));
+    return signData(data);
+  }
+
+protected:
+  const std::filesystem::path m_path{std::filesystem::path(UNIT_TESTS_TMPDIR) / "TestDiskStorage"};
+  const std::string m_dir{m_path.string()};
+};
+
+BOOST_AUTO_TEST_SUITE(Ims)
+BOOST_FIXTURE_TEST_SUITE(TestDiskStorage, DiskStorageFixture)
+
+BOOST_AUTO_TEST_CASE(InsertAndFind)
+{
+  DiskStorage storage(m_dir);
+  BOOST_CHECK_EQUAL(storage.size(), 0);
+
+  auto a = makeData("/A");
+  auto b = makeData("/A/B");
+  BOOST_CHECK_EQUAL(storage.insert(*a), true);
+  BOOST_CHECK_EQUAL(storage.insert(*b), true);
+  BOOST_CHECK_EQUAL(storage.insert(*a), false);
+  BOOST_CHECK_EQUAL(storage.size(), 2);
+
+  auto found = storage.find(Name("/A"));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(*found, *a);
+  found = storage.find(b->getFullName());
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(*found, *b);
+  BOOST_CHECK(storage.find(Name("/A/C")) == nullptr);
+  BOOST_CHECK(storage.find(Name("/A").appendImplicitSha256Digest(b->getFullName()[-1].value_bytes()))
+              == nullptr);
+
+  // same name, different digest
+  auto a2 = makeData("/A");
+  a2->setContent(std::vector<uint8_t>{0x01});
+  signData(a2);
+  BOOST_CHECK_EQUAL(storage.insert(*a2), true);
+  BOOST_CHECK_EQUAL(storage.size(), 3);
+  found = storage.find(a2->getFullName());
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(*found, *a2);
+}
+
+BOOST_AUTO_TEST_CASE(FindInterest)
+{
+  DiskStorage storage(m_dir);
+  auto data = makeData("/A/B");
+  storage.insert(*data);
+
+  BOOST_CHECK(storage.find(*makeInterest("/A/B")) != nullptr);
+  BOOST_CHECK(storage.find(*makeInterest(data->getFullName())) != nullptr);
+  BOOST_CHECK(storage.find(*makeInterest("/A/B", true)) != nullptr);
+  BOOST_CHECK(storage.find(*makeInterest("/A")) == nullptr);
+  // only exact matches are returned
+  BOOST_CHECK(storage.find(*makeInterest("/A", true)) == nullptr);
+  // packets on disk are stale
+  BOOST_CHECK(storage.find(makeInterest("/A/B")->setMustBeFresh(true)) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  DiskStorage storage(m_dir);
+  auto ab = makeData("/A/B");
+  auto ac = makeData("/A/C");
+  auto d = makeData("/D");
+  storage.insert(*ab);
+  storage.insert(*ac);
+  storage.insert(*d);
+
+  storage.erase(ab->getFullName(), false);
+  BOOST_CHECK_EQUAL(storage.size(), 2);
+  BOOST_CHECK(storage.find(Name("/A/B")) == nullptr);
+
+  storage.erase("/A/B", false);
+  BOOST_CHECK_EQUAL(storage.size(), 2);
+
+  storage.erase("/A");
+  BOOST_CHECK_EQUAL(storage.size(), 1);
+  BOOST_CHECK(storage.find(Name("/A/C")) == nullptr);
+  BOOST_CHECK(storage.find(Name("/D")) != nullptr);
+
+  // an erased packet can be inserted again
+  BOOST_CHECK_EQUAL(storage.insert(*ab), true);
+  BOOST_CHECK(storage.find(Name("/A/B")) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Reopen)
+{
+  std::vector<shared_ptr<Data>> packets;
+  uint64_t segmentSize = 0;
+  {
+    DiskStorage storage(m_dir);
+    // large enough to grow both files several times
+    for (int i = 0; i < 2000; ++i) {
+      packets.push_back(makeLargeData("/R/" + to_string(i), 100));
+      BOOST_CHECK_EQUAL(storage.insert(*packets.back()), true);
+    }
+    storage.erase("/R/7", false);
+    storage.erase(packets[8]->getFullName(), false);
+    segmentSize = storage.getSegmentSize();
+    BOOST_CHECK_GT(segmentSize, 2000 * 100);
+  }
+
+  DiskStorage storage(m_dir);
+  BOOST_CHECK_EQUAL(storage.size(), 1999);
+  BOOST_CHECK_EQUAL(storage.getSegmentSize(), segmentSize);
+  BOOST_CHECK(storage.find(Name("/R/8")) == nullptr);
+  for (int i : {0, 7, 1000, 1999}) {
+    auto found = storage.find(Name("/R/" + to_string(i)));
+    BOOST_REQUIRE(found != nullptr);
+    BOOST_CHECK_EQUAL(*found, *packets[i]);
+  }
+  BOOST_CHECK_EQUAL(storage.insert(*packets[0]), false);
+  BOOST_CHECK_EQUAL(storage.insert(*packets[8]), true);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidFile)
+{
+  std::filesystem::create_directories(m_path);
+  {
+    std::ofstream of(m_path / "packets.seg", std::ios::binary);
+    of << "this is not a segment file";
+  }
+  BOOST_CHECK_THROW(DiskStorage{m_dir}, DiskStorage::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDiskStorage
+BOOST_AUTO_TEST_SUITE_END() // Ims
+
+} // namespace ndn::tests
@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-arc.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn::tests {
+
+BOOST_AUTO_TEST_SUITE(Ims)
+BOOST_AUTO_TEST_SUITE(TestInMemoryStorageArc)
+
+BOOST_AUTO_TEST_CASE(RecencyAndFrequency)
+{
+  InMemoryStorageArc ims;
+
+  ims.insert(*makeData("/A"));
+  ims.insert(*makeData("/B"));
+  ims.insert(*makeData("/C"));
+  BOOST_CHECK_EQUAL(ims.m_recent.size(), 3);
+  BOOST_CHECK_EQUAL(ims.m_frequent.size(), 0);
+
+  ims.find(*makeInterest("/B"));
+  BOOST_CHECK_EQUAL(ims.m_recent.size(), 2);
+  BOOST_CHECK_EQUAL(ims.m_frequent.size(), 1);
+
+  // the recency list exceeds its target size, so its least recently used packet is evicted
+  BOOST_CHECK(ims.evictItem());
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK(ims.find(Name("/A")) == nullptr);
+  BOOST_CHECK_EQUAL(ims.m_recentGhost.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(GhostHit)
+{
+  InMemoryStorageArc ims(4);
+
+  for (const char* name : {"/A", "/B", "/C", "/D"}) {
+    ims.insert(*makeData(name));
+  }
+  ims.find(*makeInterest("/D"));
+
+  // /A is evicted from the recency list into its ghost list
+  ims.insert(*makeData("/E"));
+  BOOST_CHECK(ims.find(Name("/A")) == nullptr);
+  BOOST_CHECK_EQUAL(ims.m_target, 0);
+
+  // re-inserting /A hits the recency ghost list, which grows the target of the recency list
+  // and places /A in the frequency list
+  ims.insert(*makeData("/A"));
+  BOOST_CHECK_EQUAL(ims.m_target, 1);
+  BOOST_CHECK_EQUAL(ims.m_frequent.size(), 2);
+  BOOST_CHECK_EQUAL(ims.size(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(ScanResistance)
+{
+  InMemoryStorageArc ims(8);
+
+  std::vector<Name> hot;
+  for (int i = 0; i < 4; ++i) {
+    hot.emplace_back("/hot/" + to_string(i));
+    ims.insert(*makeData(hot.back()));
+  }
+  for (const auto& name : hot) {
+    BOOST_CHECK(ims.find(*makeInterest(name)) != nullptr);
+  }
+
+  // a sequential scan of packets that are never accessed again
+  for (int i = 0; i < 100; ++i) {
+    ims.insert(*makeData("/scan/" + to_string(i)));
+  }
+
+  BOOST_CHECK_EQUAL(ims.size(), 8);
+  for (const auto& name : hot) {
+    BOOST_CHECK(ims.find(*makeInterest(name)) != nullptr);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  InMemoryStorageArc ims;
+  ims.insert(*makeData("/A/1"));
+  ims.insert(*makeData("/A/2"));
+  ims.find(*makeInterest("/A/2"));
+
+  ims.erase("/A");
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+  BOOST_CHECK_EQUAL(ims.m_recent.size(), 0);
+  BOOST_CHECK_EQUAL(ims.m_frequent.size(), 0);
+  BOOST_CHECK(!ims.evictItem());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorageArc
+BOOST_AUTO_TEST_SUITE_END() // Ims
+
+} // namespace ndn::tests
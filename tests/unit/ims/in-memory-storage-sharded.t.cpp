@@ -0,0 +1,237 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-sharded.hpp"
+#include "ndn-cxx/ims/in-memory-storage-lru.hpp"
+#include "ndn-cxx/ims/in-memory-storage-persistent.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace ndn::tests {
+
+BOOST_AUTO_TEST_SUITE(Ims)
+BOOST_AUTO_TEST_SUITE(TestInMemoryStorageSharded)
+
+const auto makePersistent = [] { return make_unique<InMemoryStoragePersistent>(); };
+
+BOOST_AUTO_TEST_CASE(Construct)
+{
+  BOOST_CHECK_THROW(InMemoryStorageSharded(0, makePersistent), std::invalid_argument);
+
+  InMemoryStorageSharded ims(4, makePersistent);
+  BOOST_CHECK_EQUAL(ims.getNShards(), 4);
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(InsertAndFind)
+{
+  InMemoryStorageSharded ims(8, makePersistent);
+
+  std::vector<shared_ptr<Data>> packets;
+  std::set<size_t> usedShards;
+  size_t nBytes = 0;
+  for (int i = 0; i < 32; ++i) {
+    auto data = makeData("/A/" + to_string(i));
+    packets.push_back(data);
+    usedShards.insert(ims.getShardIndex(data->getName()));
+    nBytes += InMemoryStorageEntry::computeSize(*data);
+    ims.insert(*data);
+  }
+  BOOST_CHECK_EQUAL(ims.size(), 32);
+  BOOST_CHECK_GT(usedShards.size(), 1);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), nBytes);
+
+  for (const auto& data : packets) {
+    auto found = ims.find(*makeInterest(data->getName()));
+    BOOST_REQUIRE(found != nullptr);
+    BOOST_CHECK_EQUAL(found->getName(), data->getName());
+
+    found = ims.find(*makeInterest(data->getFullName()));
+    BOOST_REQUIRE(found != nullptr);
+    BOOST_CHECK_EQUAL(found->getFullName(), data->getFullName());
+
+    found = ims.find(data->getName());
+    BOOST_REQUIRE(found != nullptr);
+    BOOST_CHECK_EQUAL(found->getName(), data->getName());
+
+    found = ims.find(data->getFullName());
+    BOOST_REQUIRE(found != nullptr);
+    BOOST_CHECK_EQUAL(found->getFullName(), data->getFullName());
+  }
+
+  BOOST_CHECK(ims.find(*makeInterest("/A")) == nullptr);
+  BOOST_CHECK(ims.find(*makeInterest("/A/100")) == nullptr);
+  BOOST_CHECK(ims.find(Name("/B")) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(FindPrefix)
+{
+  InMemoryStorageSharded ims(8, makePersistent);
+  for (int i = 9; i >= 1; --i) {
+    ims.insert(*makeData(Name("/A").appendNumber(i)));
+  }
+  ims.insert(*makeData("/B"));
+
+  // the leftmost match in canonical order is returned, regardless of the shard
+  auto found = ims.find(*makeInterest("/A", true));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getName(), Name("/A").appendNumber(1));
+
+  found = ims.find(Name("/A"));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getName(), Name("/A").appendNumber(1));
+
+  BOOST_CHECK(ims.find(*makeInterest("/C", true)) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(CountLookupsOnce)
+{
+  std::vector<InMemoryStorage*> shards;
+  InMemoryStorageSharded ims(8, [&] {
+    auto shard = make_unique<InMemoryStoragePersistent>();
+    shards.push_back(shard.get());
+    return shard;
+  });
+  for (int i = 9; i >= 1; --i) {
+    ims.insert(*makeData(Name("/A").appendNumber(i)));
+  }
+
+  auto countHits = [&] {
+    uint64_t n = 0;
+    for (auto shard : shards) {
+      n += shard->getCounters().nHits;
+    }
+    return n;
+  };
+  auto countMisses = [&] {
+    uint64_t n = 0;
+    for (auto shard : shards) {
+      n += shard->getCounters().nMisses;
+    }
+    return n;
+  };
+
+  // a lookup that visits all shards counts one hit, in the shard of the returned packet
+  auto& firstShard = *shards.at(ims.getShardIndex(Name("/A").appendNumber(1)));
+  BOOST_CHECK(ims.find(*makeInterest("/A", true)) != nullptr);
+  BOOST_CHECK_EQUAL(countHits(), 1);
+  BOOST_CHECK_EQUAL(firstShard.getCounters().nHits, 1);
+  BOOST_CHECK(ims.find(Name("/A")) != nullptr);
+  BOOST_CHECK_EQUAL(countHits(), 2);
+  BOOST_CHECK_EQUAL(firstShard.getCounters().nHits, 2);
+
+  // an exact match is counted once
+  BOOST_CHECK(ims.find(Name("/A").appendNumber(5)) != nullptr);
+  BOOST_CHECK_EQUAL(countHits(), 3);
+  BOOST_CHECK_EQUAL(countMisses(), 0);
+
+  // a lookup without match counts one miss, in the shard of the looked-up name
+  BOOST_CHECK(ims.find(*makeInterest("/C", true)) == nullptr);
+  BOOST_CHECK_EQUAL(countMisses(), 1);
+  BOOST_CHECK_EQUAL(shards.at(ims.getShardIndex("/C"))->getCounters().nMisses, 1);
+  BOOST_CHECK(ims.find(Name("/C")) == nullptr);
+  BOOST_CHECK_EQUAL(countMisses(), 2);
+  BOOST_CHECK_EQUAL(countHits(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  InMemoryStorageSharded ims(8, makePersistent);
+  std::vector<shared_ptr<Data>> packets;
+  for (int i = 0; i < 16; ++i) {
+    packets.push_back(makeData("/A/" + to_string(i)));
+    ims.insert(*packets.back());
+    ims.insert(*makeData("/B/" + to_string(i)));
+  }
+  BOOST_CHECK_EQUAL(ims.size(), 32);
+
+  ims.erase(packets[0]->getFullName(), false);
+  BOOST_CHECK_EQUAL(ims.size(), 31);
+  BOOST_CHECK(ims.find(packets[0]->getName()) == nullptr);
+
+  ims.erase("/A");
+  BOOST_CHECK_EQUAL(ims.size(), 16);
+  BOOST_CHECK(ims.find(*makeInterest("/A", true)) == nullptr);
+  BOOST_CHECK(ims.find(*makeInterest("/B", true)) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(PerShardPolicy)
+{
+  InMemoryStorageSharded ims(4, [] { return make_unique<InMemoryStorageLru>(2); });
+  for (int i = 0; i < 100; ++i) {
+    ims.insert(*makeData("/A/" + to_string(i)));
+  }
+  BOOST_CHECK_LE(ims.size(), 4 * 2);
+
+  auto entrySize = InMemoryStorageEntry::computeSize(*makeData("/A/0"));
+  ims.setByteLimit(4 * entrySize);
+  BOOST_CHECK_LE(ims.size(), 4);
+  BOOST_CHECK_LE(ims.getNBytes(), 4 * entrySize);
+}
+
+BOOST_AUTO_TEST_CASE(Concurrent)
+{
+  InMemoryStorageSharded ims(8, [] { return make_unique<InMemoryStorageLru>(100000); });
+
+  const int nThreads = 4;
+  const int nPackets = 200;
+  std::vector<std::vector<shared_ptr<Data>>> packets(nThreads);
+  for (int t = 0; t < nThreads; ++t) {
+    for (int i = 0; i < nPackets; ++i) {
+      auto data = makeData("/T/" + to_string(t) + "/" + to_string(i));
+      data->getFullName(); // compute the digest before sharing the packet between threads
+      packets[t].push_back(data);
+    }
+  }
+
+  std::atomic<int> nMisses{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < nThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (const auto& data : packets[t]) {
+        ims.insert(*data);
+      }
+      for (const auto& data : packets[(t + 1) % nThreads]) {
+        // packets inserted by another thread may or may not be present yet
+        ims.find(data->getName());
+      }
+      for (const auto& data : packets[t]) {
+        if (ims.find(data->getFullName()) == nullptr) {
+          ++nMisses;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  BOOST_CHECK_EQUAL(nMisses, 0);
+  BOOST_CHECK_EQUAL(ims.size(), nThreads * nPackets);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorageSharded
+BOOST_AUTO_TEST_SUITE_END() // Ims
+
+} // namespace ndn::tests
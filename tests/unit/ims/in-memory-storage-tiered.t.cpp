@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-tiered.hpp"
+#include "ndn-cxx/ims/in-memory-storage-fifo.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/unit/io-fixture.hpp"
+
+#include <filesystem>
+
+namespace ndn::tests {
+
+class InMemoryStorageTieredFixture : public IoFixture
+{
+protected:
+  ~InMemoryStorageTieredFixture()
+  {
+    std::filesystem::remove_all(m_path);
+  }
+
+  unique_ptr<InMemoryStorageTiered>
+  makeStorage(size_t memoryLimit)
+  {
+    return make_unique<InMemoryStorageTiered>(make_unique<InMemoryStorageFifo>(m_io, memoryLimit),
+                                              m_path.string());
+  }
+
+protected:
+  const std::filesystem::path m_path{std::filesystem::path(UNIT_TESTS_TMPDIR) /
+                                     "TestInMemoryStorageTiered"};
+};
+
+BOOST_AUTO_TEST_SUITE(Ims)
+BOOST_FIXTURE_TEST_SUITE(TestInMemoryStorageTiered, InMemoryStorageTieredFixture)
+
+BOOST_AUTO_TEST_CASE(SpillAndPromote)
+{
+  auto ims = makeStorage(2);
+  auto a = makeData("/A");
+  auto b = makeData("/B");
+  auto c = makeData("/C");
+  ims->insert(*a);
+  ims->insert(*b);
+  BOOST_CHECK_EQUAL(ims->getDiskTier().size(), 0);
+
+  // inserting C evicts A from memory to disk
+  ims->insert(*c);
+  BOOST_CHECK_EQUAL(ims->getMemoryTier().size(), 2);
+  BOOST_CHECK_EQUAL(ims->getDiskTier().size(), 1);
+  BOOST_CHECK(ims->getMemoryTier().find(Name("/A")) == nullptr);
+
+  // a hit on disk promotes A, which evicts B
+  auto found = ims->find(*makeInterest("/A"));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(*found, *a);
+  BOOST_CHECK(ims->getMemoryTier().find(Name("/A")) != nullptr);
+  BOOST_CHECK(ims->getMemoryTier().find(Name("/B")) == nullptr);
+  BOOST_CHECK_EQUAL(ims->getDiskTier().size(), 2);
+
+  found = ims->find(b->getFullName());
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(*found, *b);
+
+  // A is already on disk and is not written again when evicted
+  auto segmentSize = ims->getDiskTier().getSegmentSize();
+  ims->insert(*makeData("/D"));
+  BOOST_CHECK_EQUAL(ims->getDiskTier().getSegmentSize(), segmentSize);
+}
+
+BOOST_AUTO_TEST_CASE(PromotedIsStale)
+{
+  auto ims = make_unique<InMemoryStorageTiered>(make_unique<InMemoryStorageFifo>(m_io, 1),
+                                                m_path.string());
+  ims->insert(*makeData("/A"));
+  ims->insert(*makeData("/B"));
+
+  BOOST_CHECK(ims->find(makeInterest("/A")->setMustBeFresh(true)) == nullptr);
+  BOOST_CHECK(ims->find(*makeInterest("/A")) != nullptr);
+  BOOST_CHECK(ims->getMemoryTier().find(makeInterest("/A")->setMustBeFresh(true)) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(MemoryTierWithoutFreshness)
+{
+  // such a memory tier would answer MustBeFresh with promoted packets
+  BOOST_CHECK_THROW(InMemoryStorageTiered(make_unique<InMemoryStorageFifo>(1), m_path.string()),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  auto ims = makeStorage(1);
+  ims->insert(*makeData("/A/1"));
+  ims->insert(*makeData("/A/2"));
+  ims->insert(*makeData("/B"));
+  BOOST_CHECK_EQUAL(ims->getDiskTier().size(), 2);
+
+  ims->erase("/A");
+  BOOST_CHECK_EQUAL(ims->getDiskTier().size(), 0);
+  BOOST_CHECK(ims->find(Name("/A/1")) == nullptr);
+  BOOST_CHECK(ims->find(Name("/B")) != nullptr);
+
+  ims->erase("/B");
+  BOOST_CHECK_EQUAL(ims->getMemoryTier().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Restart)
+{
+  std::vector<shared_ptr<Data>> packets;
+  for (int i = 0; i < 10; ++i) {
+    packets.push_back(makeData("/P/" + to_string(i)));
+  }
+
+  {
+    auto ims = makeStorage(4);
+    ims->flush();
+    for (const auto& data : packets) {
+      ims->insert(*data);
+    }
+    BOOST_CHECK_EQUAL(ims->getDiskTier().size(), 6);
+    ims->flush();
+    BOOST_CHECK_EQUAL(ims->getDiskTier().size(), 10);
+  }
+
+  auto ims = makeStorage(4);
+  BOOST_CHECK_EQUAL(ims->getMemoryTier().size(), 0);
+  BOOST_CHECK_EQUAL(ims->getDiskTier().size(), 10);
+  for (const auto& data : packets) {
+    auto found = ims->find(*makeInterest(data->getName()));
+    BOOST_REQUIRE(found != nullptr);
+    BOOST_CHECK_EQUAL(*found, *data);
+  }
+  BOOST_CHECK_EQUAL(ims->getMemoryTier().size(), 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorageTiered
+BOOST_AUTO_TEST_SUITE_END() // Ims
+
+} // namespace ndn::tests
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-tinylfu.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn::tests {
+
+BOOST_AUTO_TEST_SUITE(Ims)
+BOOST_AUTO_TEST_SUITE(TestInMemoryStorageTinyLfu)
+
+BOOST_AUTO_TEST_CASE(Sketch)
+{
+  InMemoryStorageTinyLfu::FrequencySketch sketch;
+  BOOST_CHECK_EQUAL(sketch.getWidth(), InMemoryStorageTinyLfu::FrequencySketch::MIN_WIDTH);
+  BOOST_CHECK_EQUAL(sketch.estimate(1), 0);
+
+  for (int i = 0; i < 5; ++i) {
+    sketch.increment(1);
+  }
+  sketch.increment(2);
+  BOOST_CHECK_GE(sketch.estimate(1), 5);
+  BOOST_CHECK_GE(sketch.estimate(2), 1);
+  BOOST_CHECK_LT(sketch.estimate(2), sketch.estimate(1));
+
+  // counters saturate
+  for (int i = 0; i < 100; ++i) {
+    sketch.increment(1);
+  }
+  BOOST_CHECK_EQUAL(sketch.estimate(1), InMemoryStorageTinyLfu::FrequencySketch::MAX_COUNT);
+
+  // counters are halved after a sample period
+  for (size_t i = 0; i < 10 * sketch.getWidth(); ++i) {
+    sketch.increment(1000 + i % 7);
+  }
+  BOOST_CHECK_LT(sketch.estimate(1), InMemoryStorageTinyLfu::FrequencySketch::MAX_COUNT);
+
+  // growing the sketch keeps the estimates
+  std::vector<uint8_t> estimates;
+  for (size_t key = 0; key < 2000; ++key) {
+    estimates.push_back(sketch.estimate(key));
+  }
+  sketch.ensureWidth(1000);
+  BOOST_CHECK_EQUAL(sketch.getWidth(), 1024);
+  for (size_t key = 0; key < 2000; ++key) {
+    BOOST_CHECK_EQUAL(sketch.estimate(key), estimates[key]);
+  }
+  BOOST_CHECK_GT(sketch.estimate(1), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Admission)
+{
+  InMemoryStorageTinyLfu ims(4);
+
+  for (const char* name : {"/A", "/B", "/C", "/D"}) {
+    ims.insert(*makeData(name));
+  }
+  ims.find(*makeInterest("/A"));
+  ims.find(*makeInterest("/B"));
+
+  // the main area is populated from the window; then /A and /B, which have been accessed,
+  // are admitted into the main area, and /E, which has not, is rejected
+  ims.insert(*makeData("/E"));
+  ims.insert(*makeData("/F"));
+  ims.insert(*makeData("/G"));
+  BOOST_CHECK_EQUAL(ims.size(), 4);
+  BOOST_CHECK(ims.find(Name("/A")) != nullptr);
+  BOOST_CHECK(ims.find(Name("/B")) != nullptr);
+  BOOST_CHECK(ims.find(Name("/E")) == nullptr);
+  BOOST_CHECK(ims.find(Name("/G")) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ScanResistance)
+{
+  InMemoryStorageTinyLfu ims(8);
+
+  std::vector<Name> hot;
+  for (int i = 0; i < 4; ++i) {
+    hot.emplace_back("/hot/" + to_string(i));
+    ims.insert(*makeData(hot.back()));
+  }
+  for (int round = 0; round < 3; ++round) {
+    for (const auto& name : hot) {
+      BOOST_CHECK(ims.find(*makeInterest(name)) != nullptr);
+    }
+  }
+
+  // a sequential scan of packets that are never accessed again
+  for (int i = 0; i < 100; ++i) {
+    ims.insert(*makeData("/scan/" + to_string(i)));
+  }
+
+  BOOST_CHECK_EQUAL(ims.size(), 8);
+  for (const auto& name : hot) {
+    BOOST_CHECK(ims.find(*makeInterest(name)) != nullptr);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Promotion)
+{
+  InMemoryStorageTinyLfu ims(4);
+  for (const char* name : {"/A", "/B", "/C", "/D"}) {
+    ims.insert(*makeData(name));
+  }
+  ims.insert(*makeData("/E"));
+  BOOST_CHECK_EQUAL(ims.m_probation.size(), 2);
+  BOOST_CHECK_EQUAL(ims.m_protected.size(), 0);
+
+  // a hit in the probation list moves the packet to the protected list
+  auto probationFront = *ims.m_probation.get<1>().begin();
+  ims.find(*makeInterest(probationFront->getName()));
+  BOOST_CHECK_EQUAL(ims.m_probation.size(), 1);
+  BOOST_CHECK_EQUAL(ims.m_protected.size(), 1);
+
+  ims.erase("/");
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+  BOOST_CHECK_EQUAL(ims.m_window.size() + ims.m_probation.size() + ims.m_protected.size(), 0);
+  BOOST_CHECK(!ims.evictItem());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorageTinyLfu
+BOOST_AUTO_TEST_SUITE_END() // Ims
+
+} // namespace ndn::tests
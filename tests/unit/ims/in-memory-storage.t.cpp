@@ -20,15 +20,19 @@
  */
 
 #include "ndn-cxx/ims/in-memory-storage.hpp"
+#include "ndn-cxx/ims/in-memory-storage-arc.hpp"
 #include "ndn-cxx/ims/in-memory-storage-fifo.hpp"
 #include "ndn-cxx/ims/in-memory-storage-lfu.hpp"
 #include "ndn-cxx/ims/in-memory-storage-lru.hpp"
 #include "ndn-cxx/ims/in-memory-storage-persistent.hpp"
+#include "ndn-cxx/ims/in-memory-storage-tinylfu.hpp"
 #include "ndn-cxx/util/sha256.hpp"
 
 #include "tests/test-common.hpp"
 #include "tests/unit/io-fixture.hpp"
 
+#include <map>
+
 #include <boost/mp11/list.hpp>
 
 namespace ndn::tests {
@@ -39,7 +43,9 @@ BOOST_AUTO_TEST_SUITE(TestInMemoryStorage)
 using InMemoryStorages = boost::mp11::mp_list<InMemoryStoragePersistent,
                                               InMemoryStorageFifo,
                                               InMemoryStorageLfu,
-                                              InMemoryStorageLru>;
+                                              InMemoryStorageLru,
+                                              InMemoryStorageArc,
+                                              InMemoryStorageTinyLfu>;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(Insertion, T, InMemoryStorages)
 {
@@ -373,7 +379,9 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(EraseCanonical, T, InMemoryStorages)
 
 using InMemoryStoragesLimited = boost::mp11::mp_list<InMemoryStorageFifo,
                                                      InMemoryStorageLfu,
-                                                     InMemoryStorageLru>;
+                                                     InMemoryStorageLru,
+                                                     InMemoryStorageArc,
+                                                     InMemoryStorageTinyLfu>;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(SetCapacity, T, InMemoryStoragesLimited)
 {
@@ -437,6 +445,104 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(InsertAndEvict, T, InMemoryStoragesLimited)
   BOOST_CHECK(found == nullptr);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(ByteLimit, T, InMemoryStoragesLimited)
+{
+  T ims;
+  BOOST_CHECK_EQUAL(ims.getByteLimit(), std::numeric_limits<size_t>::max());
+  BOOST_CHECK_EQUAL(ims.getNBytes(), 0);
+
+  auto data1 = makeData("/byte/1");
+  size_t entrySize = InMemoryStorageEntry::computeSize(*data1);
+  BOOST_CHECK_GT(entrySize, data1->wireEncode().size());
+
+  ims.insert(*data1);
+  ims.insert(*makeData("/byte/2"));
+  ims.insert(*makeData("/byte/3"));
+  BOOST_CHECK_EQUAL(ims.size(), 3);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), 3 * entrySize);
+
+  // reducing the limit evicts packets
+  ims.setByteLimit(2 * entrySize + entrySize / 2);
+  BOOST_CHECK_EQUAL(ims.getByteLimit(), 2 * entrySize + entrySize / 2);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), 2 * entrySize);
+
+  // inserting evicts packets to stay within the limit
+  for (int i = 4; i < 10; ++i) {
+    ims.insert(*makeData("/byte/" + to_string(i)));
+    BOOST_CHECK_EQUAL(ims.size(), 2);
+    BOOST_CHECK_LE(ims.getNBytes(), ims.getByteLimit());
+  }
+  BOOST_CHECK(ims.find(Name("/byte/9")) != nullptr);
+
+  // a packet larger than the limit is not inserted
+  auto big = makeData("/byte/big");
+  big->setContent(std::vector<uint8_t>(3 * entrySize));
+  signData(big);
+  ims.insert(*big);
+  BOOST_CHECK(ims.find(Name("/byte/big")) == nullptr);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+
+  ims.erase("/byte");
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ByteLimitPersistent)
+{
+  InMemoryStoragePersistent ims;
+  auto data1 = makeData("/byte/1");
+  size_t entrySize = InMemoryStorageEntry::computeSize(*data1);
+
+  ims.insert(*data1);
+  ims.insert(*makeData("/byte/2"));
+  BOOST_CHECK_THROW(ims.setByteLimit(entrySize), InMemoryStorage::Error);
+  BOOST_CHECK_EQUAL(ims.getByteLimit(), std::numeric_limits<size_t>::max());
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+
+  // a persistent storage cannot evict, so new packets are rejected
+  ims.setByteLimit(2 * entrySize);
+  ims.insert(*makeData("/byte/3"));
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK(ims.find(Name("/byte/3")) == nullptr);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), 2 * entrySize);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Counters, T, InMemoryStoragesLimited)
+{
+  T ims(2);
+  const auto& counters = ims.getCounters();
+
+  auto data1 = makeData("/counters/1");
+  ims.insert(*data1);
+  ims.insert(*makeData("/counters/2"));
+  ims.insert(*makeData("/counters/3"));
+  BOOST_CHECK_EQUAL(counters.nEvictions, 1);
+
+  BOOST_CHECK(ims.find(Name("/counters/3")) != nullptr);
+  BOOST_CHECK(ims.find(Name("/counters/8")) == nullptr);
+  BOOST_CHECK(ims.find(*makeInterest("/counters/3")) != nullptr);
+  BOOST_CHECK(ims.find(*makeInterest("/counters/9")) == nullptr);
+  BOOST_CHECK_EQUAL(counters.nHits, 2);
+  BOOST_CHECK_EQUAL(counters.nMisses, 2);
+
+  size_t entrySize = InMemoryStorageEntry::computeSize(*data1);
+  ims.setByteLimit(entrySize);
+  BOOST_CHECK_EQUAL(counters.nEvictions, 2);
+
+  auto big = makeData("/counters/big");
+  big->setContent(std::vector<uint8_t>(entrySize));
+  signData(big);
+  ims.insert(*big);
+  BOOST_CHECK_EQUAL(counters.nRejectedInserts, 1);
+
+  // erasing is not an eviction
+  ims.erase("/counters");
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+  BOOST_CHECK_EQUAL(counters.nEvictions, 2);
+  BOOST_CHECK_EQUAL(counters.nStaleHits, 0);
+}
+
 // Find function is implemented at the base case, so it's sufficient to test for one derived class.
 class FindFixture : public IoFixture
 {
@@ -501,6 +607,64 @@ BOOST_AUTO_TEST_CASE(ExactName)
   BOOST_CHECK_EQUAL(find(), 2);
 }
 
+BOOST_AUTO_TEST_CASE(ExactName_MustBeFresh)
+{
+  insert(1, "/A", nullptr, 1_s);
+  insert(2, "/A", nullptr, 1_h);
+  insert(3, "/A/B", nullptr, 1_h);
+
+  advanceClocks(500_ms); // @500ms
+  startInterest("/A")
+    .setMustBeFresh(true);
+  auto found = find();
+  BOOST_CHECK(found == 1 || found == 2);
+
+  advanceClocks(1500_ms); // @2s
+  startInterest("/A")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 2);
+
+  advanceClocks(2_h); // @2h
+  startInterest("/A")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+
+  startInterest("/A");
+  found = find();
+  BOOST_CHECK(found == 1 || found == 2);
+}
+
+BOOST_AUTO_TEST_CASE(ExactName_SameNameDifferentDigests)
+{
+  // packets with the same name and different content, hence different digests
+  std::map<Name, uint32_t> ids;
+  for (uint32_t id = 1; id <= 8; ++id) {
+    ids.emplace(insert(id, "/A"), id);
+  }
+  BOOST_REQUIRE_EQUAL(ids.size(), 8);
+  const auto& [firstFullName, firstId] = *ids.begin();
+
+  startInterest("/A");
+  BOOST_CHECK_EQUAL(find(), firstId);
+
+  auto found = m_ims.find(Name("/A"));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getFullName(), firstFullName);
+}
+
+BOOST_AUTO_TEST_CASE(ExactName_AfterErase)
+{
+  Name n1 = insert(1, "/A");
+  insert(2, "/A/B");
+
+  m_ims.erase(n1, false);
+  startInterest("/A");
+  BOOST_CHECK_EQUAL(find(), 0);
+  startInterest(n1);
+  BOOST_CHECK_EQUAL(find(), 0);
+  BOOST_CHECK(m_ims.find(Name("/A/B")) != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(ExactName_CanBePrefix)
 {
   insert(1, "/");
@@ -594,6 +758,57 @@ BOOST_AUTO_TEST_CASE(MustBeFresh)
   BOOST_CHECK_EQUAL(find(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(MustBeFreshLazy)
+{
+  insert(1, "/A", nullptr, 1_s);
+
+  // freshness does not depend on any timer running on the io_context
+  m_steadyClock->advance(999_ms);
+  startInterest("/A")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 1);
+
+  m_steadyClock->advance(1_ms);
+  BOOST_CHECK_EQUAL(find(), 0);
+  BOOST_CHECK_EQUAL(m_io.poll(), 0);
+
+  // re-inserting the same packet does not refresh it
+  insert(1, "/A", nullptr, 1_s);
+  BOOST_CHECK_EQUAL(find(), 0);
+
+  startInterest("/A");
+  BOOST_CHECK_EQUAL(find(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(StaleHitCounter)
+{
+  insert(1, "/A/1", nullptr, 1_s);
+  m_steadyClock->advance(1_s);
+  const auto& counters = m_ims.getCounters();
+
+  startInterest("/A/1")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+  BOOST_CHECK_EQUAL(counters.nMisses, 1);
+  BOOST_CHECK_EQUAL(counters.nStaleHits, 1);
+
+  startInterest("/A")
+    .setCanBePrefix(true)
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+  BOOST_CHECK_EQUAL(counters.nStaleHits, 2);
+
+  startInterest("/B")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+  BOOST_CHECK_EQUAL(counters.nMisses, 3);
+  BOOST_CHECK_EQUAL(counters.nStaleHits, 2);
+
+  startInterest("/A/1");
+  BOOST_CHECK_EQUAL(find(), 1);
+  BOOST_CHECK_EQUAL(counters.nHits, 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Find
 BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorage
 BOOST_AUTO_TEST_SUITE_END() // Ims
@@ -0,0 +1,110 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/mgmt/counters-dataset.hpp"
+#include "ndn-cxx/ims/in-memory-storage-lru.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+#include "ndn-cxx/version.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/unit/io-key-chain-fixture.hpp"
+
+namespace ndn::tests {
+
+using namespace ndn::mgmt;
+
+class CountersDatasetFixture : public IoKeyChainFixture
+{
+protected:
+  DummyClientFace face{m_io, m_keyChain, {true, true}};
+  Dispatcher dispatcher{face, m_keyChain};
+};
+
+BOOST_AUTO_TEST_SUITE(Mgmt)
+BOOST_FIXTURE_TEST_SUITE(TestCountersDataset, CountersDatasetFixture)
+
+BOOST_AUTO_TEST_CASE(FaceCounters)
+{
+  addFaceCountersDataset(dispatcher, "status/face", face);
+  dispatcher.addTopPrefix("/localhost/app");
+  advanceClocks(1_ms);
+
+  // prefix registration command has been sent and answered
+  const auto& counters = face.getCounters();
+  auto nOutInterests = counters.nOutInterests.get();
+  auto nInData = counters.nInData.get();
+  auto nSatisfied = counters.nSatisfiedInterests.get();
+
+  face.expressInterest(*makeInterest("/A", false, 100_ms), nullptr, nullptr, nullptr);
+  face.expressInterest(*makeInterest("/B", false, 100_ms), nullptr, nullptr, nullptr);
+  advanceClocks(1_ms);
+  face.receive(*makeData("/A"));
+  advanceClocks(1_ms);
+
+  face.sentData.clear();
+  face.receive(*makeInterest("/localhost/app/status/face", true));
+  advanceClocks(1_ms);
+
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  nfd::ForwarderStatus status(face.sentData[0].getContent().blockFromValue());
+  BOOST_CHECK_EQUAL(status.getNfdVersion(), NDN_CXX_VERSION_BUILD_STRING);
+  BOOST_CHECK_EQUAL(status.getNPitEntries(), 2); // "/B" and the dataset request itself
+  BOOST_CHECK_EQUAL(status.getNOutInterests(), nOutInterests + 2);
+  BOOST_CHECK_EQUAL(status.getNInData(), nInData + 1);
+  BOOST_CHECK_EQUAL(status.getNInInterests(), 1);
+  BOOST_CHECK_EQUAL(status.getNSatisfiedInterests(), nSatisfied + 1);
+  BOOST_CHECK_EQUAL(status.getNUnsatisfiedInterests(), 0);
+
+  auto snapshot = makeFaceCountersSnapshot(face, time::system_clock::now());
+  BOOST_CHECK_EQUAL(snapshot.getNOutData(), face.getCounters().nOutData);
+}
+
+BOOST_AUTO_TEST_CASE(ImsCounters)
+{
+  InMemoryStorageLru ims(100);
+  addImsCountersDataset(dispatcher, "status/cache", ims);
+  dispatcher.addTopPrefix("/localhost/app");
+  advanceClocks(1_ms);
+
+  ims.insert(*makeData("/A"));
+  ims.insert(*makeData("/B"));
+  ims.find(*makeInterest("/A"));
+  ims.find(*makeInterest("/C"));
+  ims.find(*makeInterest("/D"));
+
+  face.sentData.clear();
+  face.receive(*makeInterest("/localhost/app/status/cache", true));
+  advanceClocks(1_ms);
+
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  nfd::CsInfo info(face.sentData[0].getContent().blockFromValue());
+  BOOST_CHECK_EQUAL(info.getCapacity(), 100);
+  BOOST_CHECK_EQUAL(info.getEnableAdmit(), true);
+  BOOST_CHECK_EQUAL(info.getEnableServe(), true);
+  BOOST_CHECK_EQUAL(info.getNEntries(), 2);
+  BOOST_CHECK_EQUAL(info.getNHits(), 1);
+  BOOST_CHECK_EQUAL(info.getNMisses(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCountersDataset
+BOOST_AUTO_TEST_SUITE_END() // Mgmt
+
+} // namespace ndn::tests
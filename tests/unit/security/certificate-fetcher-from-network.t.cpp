@@ -123,6 +123,61 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateFailure, T, Failures, CertificateFetche
   BOOST_TEST(this->face.sentInterests.size() == 4);
 }
 
+BOOST_FIXTURE_TEST_CASE(CoalesceSuccess, CertificateFetcherFromNetworkFixture<Cert>)
+{
+  size_t nSuccesses = 0;
+  for (int i = 0; i < 5; ++i) {
+    this->validator.validate(this->data,
+      [&] (const Data&) { ++nSuccesses; },
+      [] (const Data&, const ValidationError& error) { BOOST_ERROR(error); });
+  }
+  this->mockNetworkOperations();
+
+  BOOST_TEST(nSuccesses == 5);
+  // one Interest for each certificate in the chain
+  BOOST_TEST(this->face.sentInterests.size() == 2);
+}
+
+BOOST_FIXTURE_TEST_CASE(CoalesceVerification, CertificateFetcherFromNetworkFixture<Cert>)
+{
+  size_t nJobs = 0;
+  this->validator.setVerificationExecutor(this->m_io, [&] (std::function<void()> job) {
+    ++nJobs;
+    job();
+  });
+
+  size_t nSuccesses = 0;
+  for (int i = 0; i < 5; ++i) {
+    this->validator.validate(this->data,
+      [&] (const Data&) { ++nSuccesses; },
+      [] (const Data&, const ValidationError& error) { BOOST_ERROR(error); });
+  }
+  this->mockNetworkOperations();
+
+  BOOST_TEST(nSuccesses == 5);
+  BOOST_TEST(this->face.sentInterests.size() == 2);
+  // the fetched certificate chain is verified once, together with the five packets
+  BOOST_TEST(nJobs == 1);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(CoalesceFailure, T, Failures, CertificateFetcherFromNetworkFixture<T>)
+{
+  size_t nFailures = 0;
+  for (int i = 0; i < 5; ++i) {
+    this->validator.validate(this->data,
+      [] (const Data&) { BOOST_ERROR("unexpected success"); },
+      [&] (const Data&, const ValidationError& error) {
+        BOOST_TEST(error.getCode() == ValidationError::CANNOT_RETRIEVE_CERT);
+        ++nFailures;
+      });
+  }
+  this->mockNetworkOperations();
+
+  BOOST_TEST(nFailures == 5);
+  // first interest + 3 retries, shared by all validations
+  BOOST_TEST(this->face.sentInterests.size() == 4);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCertificateFetcherFromNetwork
 BOOST_AUTO_TEST_SUITE_END() // Security
 
@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/validation-result-cache.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/unit/clock-fixture.hpp"
+
+namespace ndn::tests {
+
+using security::ValidationResultCache;
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_FIXTURE_TEST_SUITE(TestValidationResultCache, ClockFixture)
+
+BOOST_AUTO_TEST_CASE(InvalidCapacity)
+{
+  BOOST_CHECK_THROW(ValidationResultCache(0, 1_s), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Lifetime)
+{
+  ValidationResultCache cache(10, 1_s);
+  cache.insert("/A");
+  advanceClocks(500_ms);
+  cache.insert("/B");
+  BOOST_CHECK(cache.contains("/A"));
+  BOOST_CHECK(cache.contains("/B"));
+  BOOST_CHECK(!cache.contains("/C"));
+
+  advanceClocks(500_ms);
+  BOOST_CHECK(!cache.contains("/A"));
+  BOOST_CHECK(cache.contains("/B"));
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+
+  // inserting again restarts the lifetime
+  advanceClocks(400_ms);
+  cache.insert("/B");
+  advanceClocks(400_ms);
+  BOOST_CHECK(cache.contains("/B"));
+  advanceClocks(600_ms);
+  BOOST_CHECK(!cache.contains("/B"));
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  ValidationResultCache cache(2, 1_s);
+  cache.insert("/A");
+  cache.insert("/B");
+  cache.insert("/A"); // /B is now the oldest entry
+  cache.insert("/C");
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+  BOOST_CHECK(cache.contains("/A"));
+  BOOST_CHECK(!cache.contains("/B"));
+  BOOST_CHECK(cache.contains("/C"));
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  BOOST_CHECK(!cache.contains("/A"));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestValidationResultCache
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace ndn::tests
@@ -164,6 +164,18 @@ private:
     // do nothing
   }
 
+  std::function<bool()>
+  makeOriginalPacketVerifier(const std::optional<Certificate>&) const override
+  {
+    return [] { return true; };
+  }
+
+  void
+  finishOriginalPacket(bool) override
+  {
+    // do nothing
+  }
+
   void
   bypassValidation() override
   {
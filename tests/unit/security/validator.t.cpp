@@ -20,11 +20,14 @@
  */
 
 #include "ndn-cxx/security/validator.hpp"
+#include "ndn-cxx/security/certificate-fetcher-offline.hpp"
 #include "ndn-cxx/security/validation-policy-simple-hierarchy.hpp"
 
 #include "tests/test-common.hpp"
 #include "tests/unit/security/validator-fixture.hpp"
 
+#include <thread>
+
 namespace ndn::tests {
 
 using namespace ndn::security;
@@ -198,6 +201,202 @@ BOOST_AUTO_TEST_CASE(TrustedCertCaching)
   BOOST_TEST(face.sentInterests.size() > 1);
 }
 
+BOOST_AUTO_TEST_CASE(VerificationThreads)
+{
+  validator.setVerificationThreads(m_io, 2);
+
+  std::vector<Data> packets;
+  for (int i = 0; i < 8; ++i) {
+    Data data(Name("/Security/ValidatorFixture/Sub1/Sub2/Data").appendNumber(i));
+    m_keyChain.sign(data, signingByIdentity(subIdentity));
+    packets.push_back(data);
+  }
+  const uint8_t sv[] = {0x12, 0x34, 0x56, 0x78};
+  packets.back().setSignatureValue(sv);
+
+  size_t nSuccesses = 0;
+  size_t nFailures = 0;
+  const auto ioThread = std::this_thread::get_id();
+  for (const auto& data : packets) {
+    validator.validate(data,
+      [&] (const Data&) {
+        BOOST_CHECK(std::this_thread::get_id() == ioThread);
+        ++nSuccesses;
+      },
+      [&] (const Data& d, const ValidationError& error) {
+        BOOST_CHECK(std::this_thread::get_id() == ioThread);
+        BOOST_TEST(d.getName() == packets.back().getName());
+        BOOST_TEST(error.getCode() == ValidationError::INVALID_SIGNATURE);
+        ++nFailures;
+      });
+  }
+
+  mockNetworkOperations();
+  validator.setVerificationThreads(m_io, 0); // waits for pending verifications
+  advanceClocks(1_ms);
+  BOOST_TEST(nSuccesses == 7);
+  BOOST_TEST(nFailures == 1);
+
+  // synchronous verification is restored
+  nSuccesses = 0;
+  validator.validate(packets.front(), [&] (const Data&) { ++nSuccesses; },
+                     [] (const Data&, const ValidationError&) { BOOST_ERROR("unexpected failure"); });
+  BOOST_TEST(nSuccesses == 1);
+}
+
+BOOST_AUTO_TEST_CASE(VerificationExecutor)
+{
+  std::vector<std::function<void()>> jobs;
+  validator.setVerificationExecutor(m_io, [&] (std::function<void()> job) {
+    jobs.push_back(std::move(job));
+  });
+
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+  Data badData(Name(data.getName()).append("bad"));
+  m_keyChain.sign(badData, signingByIdentity(subIdentity));
+  const uint8_t sv[] = {0x12, 0x34, 0x56, 0x78};
+  badData.setSignatureValue(sv);
+
+  size_t nSuccesses = 0;
+  size_t nFailures = 0;
+  auto validate = [&] (const Data& packet) {
+    validator.validate(packet,
+      [&] (const Data&) { ++nSuccesses; },
+      [&] (const Data&, const ValidationError& error) {
+        BOOST_TEST(error.getCode() == ValidationError::INVALID_SIGNATURE);
+        ++nFailures;
+      });
+  };
+
+  // the certificate chain and the packet are verified in one job
+  validate(data);
+  mockNetworkOperations();
+  BOOST_TEST_REQUIRE(jobs.size() == 1);
+  BOOST_TEST(nSuccesses == 0);
+  std::thread(std::move(jobs.front())).join();
+  jobs.clear();
+  advanceClocks(1_ms);
+  BOOST_TEST(nSuccesses == 1);
+
+  // the verified certificate has been cached, and only the packet remains to be verified
+  face.sentInterests.clear();
+  validate(badData);
+  validate(data);
+  BOOST_TEST(face.sentInterests.size() == 0);
+  BOOST_TEST_REQUIRE(jobs.size() == 2);
+  for (auto& job : jobs) {
+    std::thread(std::move(job)).join();
+  }
+  jobs.clear();
+  advanceClocks(1_ms);
+  BOOST_TEST(nSuccesses == 2);
+  BOOST_TEST(nFailures == 1);
+
+  // synchronous verification is restored
+  validator.setVerificationExecutor(m_io, nullptr);
+  validate(data);
+  BOOST_TEST(nSuccesses == 3);
+}
+
+BOOST_AUTO_TEST_CASE(VerificationExecutorAfterDestruction)
+{
+  std::vector<std::function<void()>> jobs;
+  auto localValidator = make_unique<security::Validator>(
+    make_unique<security::ValidationPolicySimpleHierarchy>(),
+    make_unique<security::CertificateFetcherOffline>());
+  localValidator->loadAnchor("", Certificate(identity.getDefaultKey().getDefaultCertificate()));
+  localValidator->setVerificationExecutor(m_io, [&] (std::function<void()> job) {
+    jobs.push_back(std::move(job));
+  });
+
+  Data data("/Security/ValidatorFixture/Data");
+  m_keyChain.sign(data, signingByIdentity(identity));
+
+  size_t nSuccesses = 0;
+  size_t nFailures = 0;
+  localValidator->validate(data,
+    [&] (const Data&) { ++nSuccesses; },
+    [&] (const Data&, const ValidationError& error) {
+      BOOST_TEST(error.getCode() == ValidationError::IMPLEMENTATION_ERROR);
+      ++nFailures;
+    });
+  BOOST_TEST_REQUIRE(jobs.size() == 1);
+
+  // the validator is destroyed while the verification job is queued
+  localValidator.reset();
+  std::thread(std::move(jobs.front())).join();
+  advanceClocks(1_ms);
+  BOOST_TEST(nSuccesses == 0);
+  BOOST_TEST(nFailures == 1);
+}
+
+BOOST_AUTO_TEST_CASE(ResultCache)
+{
+  validator.setResultCache(10, 3_h);
+
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+  data.wireEncode();
+  VALIDATE_SUCCESS(data, "Should get accepted, as signed by the policy-compliant cert");
+  BOOST_TEST(face.sentInterests.size() == 1);
+  face.sentInterests.clear();
+
+  processInterest = nullptr; // disable data responses from mocked network
+  advanceClocks(1_h, 2); // expire trusted cache
+
+  VALIDATE_SUCCESS(data, "Should get accepted, based on the cached validation result");
+  BOOST_TEST(face.sentInterests.size() == 0);
+
+  // a different packet with the same name is fully validated
+  Data other(data);
+  other.setContent("0401FF"_block);
+  m_keyChain.sign(other, signingByIdentity(subIdentity));
+  VALIDATE_FAILURE(other, "Should try and fail to retrieve certs");
+  BOOST_TEST(lastError.getCode() == ValidationError::CANNOT_RETRIEVE_CERT);
+  face.sentInterests.clear();
+
+  advanceClocks(1_h, 2); // expire cached result
+  VALIDATE_FAILURE(data, "Should try and fail to retrieve certs");
+  BOOST_TEST(face.sentInterests.size() > 0);
+}
+
+BOOST_AUTO_TEST_CASE(ResultCacheReset)
+{
+  validator.setResultCache(10);
+
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+  data.wireEncode();
+  VALIDATE_SUCCESS(data, "Should get accepted, as signed by the policy-compliant cert");
+
+  validator.resetAnchors();
+  validator.resetVerifiedCertificates();
+  VALIDATE_FAILURE(data, "Should fail, as the cached validation result has been cleared");
+  BOOST_TEST(lastError.getCode() == ValidationError::LOOP_DETECTED);
+}
+
+BOOST_AUTO_TEST_CASE(ResultCacheResetDuringValidation)
+{
+  validator.setResultCache(10, 3_h);
+
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+  data.wireEncode();
+
+  size_t nSuccesses = 0;
+  validator.validate(data, [&] (const Data&) { ++nSuccesses; }, [] (auto&&...) {});
+  // the trust anchor remains, so the pending validation succeeds
+  validator.resetVerifiedCertificates();
+  mockNetworkOperations();
+  BOOST_TEST(nSuccesses == 1);
+
+  processInterest = nullptr; // disable data responses from mocked network
+  advanceClocks(1_h, 2); // expire trusted cache
+  VALIDATE_FAILURE(data, "Should fail, as the result was obtained across a reset and not cached");
+  BOOST_TEST(lastError.getCode() == ValidationError::CANNOT_RETRIEVE_CERT);
+}
+
 BOOST_AUTO_TEST_CASE(ResetVerifiedCerts)
 {
   Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
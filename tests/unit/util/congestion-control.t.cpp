@@ -0,0 +1,276 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/congestion-control.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/unit/clock-fixture.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <cmath>
+
+namespace ndn::tests {
+
+using namespace ndn::util;
+
+class CongestionControlFixture : public ClockFixture
+{
+public:
+  /**
+   * \brief Deliver one Data packet every \p interval for \p total, each with an RTT of \p rtt.
+   */
+  void
+  deliver(CongestionControl& cc, time::nanoseconds interval, time::nanoseconds total,
+          time::nanoseconds rtt)
+  {
+    for (time::nanoseconds elapsed = 0_ns; elapsed < total; elapsed += interval) {
+      advanceClocks(interval);
+      cc.afterReceiveData(rtt);
+    }
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_FIXTURE_TEST_SUITE(TestCongestionControl, CongestionControlFixture)
+
+BOOST_AUTO_TEST_CASE(Factory)
+{
+  BOOST_CHECK(dynamic_cast<AimdCongestionControl*>(
+                makeCongestionControl(CongestionControlAlgorithm::AIMD).get()) != nullptr);
+  BOOST_CHECK(dynamic_cast<CubicCongestionControl*>(
+                makeCongestionControl(CongestionControlAlgorithm::CUBIC).get()) != nullptr);
+  BOOST_CHECK(dynamic_cast<BbrCongestionControl*>(
+                makeCongestionControl(CongestionControlAlgorithm::BBR).get()) != nullptr);
+
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(CongestionControlAlgorithm::CUBIC), "CUBIC");
+}
+
+BOOST_AUTO_TEST_CASE(Aimd)
+{
+  CongestionControl::Options options;
+  options.initSsthresh = 4.0;
+  AimdCongestionControl cc(options);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 1.0);
+
+  // slow start
+  for (int i = 0; i < 3; ++i) {
+    cc.afterReceiveData(10_ms);
+  }
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 4.0);
+
+  // congestion avoidance
+  cc.afterReceiveData(10_ms);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 4.25);
+
+  cc.afterCongestionEvent();
+  BOOST_CHECK_EQUAL(cc.getSsthresh(), 2.125);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 2.125);
+
+  cc.afterCongestionEvent();
+  BOOST_CHECK_EQUAL(cc.getSsthresh(), CongestionControl::MIN_SSTHRESH);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), CongestionControl::MIN_SSTHRESH);
+
+  options.resetCwndToInit = true;
+  options.initCwnd = 20.0;
+  AimdCongestionControl reset(options);
+  reset.afterCongestionEvent();
+  BOOST_CHECK_EQUAL(reset.getSsthresh(), 10.0);
+  BOOST_CHECK_EQUAL(reset.getCwnd(), 20.0);
+}
+
+BOOST_AUTO_TEST_CASE(CubicRecovery)
+{
+  CongestionControl::Options options;
+  options.initCwnd = 100.0;
+  options.initSsthresh = 1.0;
+  CubicCongestionControl cc(options);
+
+  cc.afterCongestionEvent();
+  BOOST_CHECK_CLOSE(cc.getCwnd(), 100.0 * CubicCongestionControl::BETA, 0.001);
+  BOOST_CHECK_EQUAL(cc.getSsthresh(), cc.getCwnd());
+
+  // concave region: the window approaches its previous maximum after K seconds, where
+  // K = cbrt(W_max * (1 - BETA) / C) = cbrt(75) ~= 4.2s, regardless of the RTT
+  deliver(cc, 10_ms, 2_s, 100_ms);
+  double cwndBeforeK = cc.getCwnd();
+  BOOST_CHECK_GT(cwndBeforeK, 85.0);
+  BOOST_CHECK_LT(cwndBeforeK, 100.0);
+
+  deliver(cc, 10_ms, 2200_ms, 100_ms);
+  BOOST_CHECK_GT(cc.getCwnd(), cwndBeforeK);
+  BOOST_CHECK_CLOSE(cc.getCwnd(), 100.0, 5.0);
+
+  // convex region: probe beyond the previous maximum
+  deliver(cc, 10_ms, 2_s, 100_ms);
+  BOOST_CHECK_GT(cc.getCwnd(), 100.0);
+}
+
+BOOST_AUTO_TEST_CASE(CubicFastConvergence)
+{
+  CongestionControl::Options options;
+  options.initCwnd = 100.0;
+  options.initSsthresh = 1.0;
+  CubicCongestionControl cc(options);
+
+  cc.afterCongestionEvent(); // W_max = 100, cwnd = 70
+  cc.afterCongestionEvent(); // cwnd < W_max, so W_max = 70 * (1 + BETA) / 2 = 59.5
+  BOOST_CHECK_CLOSE(cc.getCwnd(), 49.0, 0.001);
+
+  // the window plateaus at the reduced W_max rather than at 100
+  deliver(cc, 10_ms, 3_s, 100_ms);
+  BOOST_CHECK_CLOSE(cc.getCwnd(), 59.5, 5.0);
+}
+
+BOOST_AUTO_TEST_CASE(CubicRenoFriendly)
+{
+  CongestionControl::Options options;
+  options.initCwnd = 10.0;
+  options.initSsthresh = 1.0;
+  CubicCongestionControl cubic(options);
+  AimdCongestionControl aimd(options);
+
+  // on a short path, the cubic function grows more slowly than AIMD, which CUBIC must keep up with
+  cubic.afterCongestionEvent();
+  aimd.afterCongestionEvent();
+  for (int i = 0; i < 10000; ++i) {
+    advanceClocks(100_us);
+    cubic.afterReceiveData(1_ms);
+    aimd.afterReceiveData(1_ms);
+  }
+  BOOST_CHECK_GT(aimd.getCwnd(), 100.0);
+  BOOST_CHECK_CLOSE(cubic.getCwnd(), aimd.getCwnd(), 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(CubicHyStart)
+{
+  CubicCongestionControl cc;
+
+  // slow start continues while the RTT is stable
+  deliver(cc, 1_ms, 50_ms, 10_ms);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 51.0);
+
+  // conservative slow start once the minimum RTT of a round has grown by more than 4ms
+  deliver(cc, 1_ms, 40_ms, 16_ms);
+  double cwnd = cc.getCwnd();
+  BOOST_CHECK_LT(cwnd, 91.0);
+  BOOST_CHECK_EQUAL(cc.getSsthresh(), std::numeric_limits<double>::max());
+  deliver(cc, 1_ms, 8_ms, 16_ms);
+  BOOST_CHECK_EQUAL(cc.getCwnd(), cwnd + 8 / CubicCongestionControl::CSS_GROWTH_DIVISOR);
+
+  // congestion avoidance after CSS_ROUNDS rounds
+  deliver(cc, 1_ms, 100_ms, 16_ms);
+  BOOST_CHECK_LT(cc.getSsthresh(), std::numeric_limits<double>::max());
+  BOOST_CHECK_LT(cc.getCwnd(), 100.0);
+}
+
+BOOST_AUTO_TEST_CASE(CubicHyStartSpuriousExit)
+{
+  CubicCongestionControl cc;
+  deliver(cc, 1_ms, 50_ms, 10_ms);
+  deliver(cc, 1_ms, 40_ms, 16_ms);
+  double cwnd = cc.getCwnd();
+
+  // the RTT goes back down, so the increase was not caused by a queue: resume slow start
+  deliver(cc, 1_ms, 40_ms, 10_ms);
+  BOOST_CHECK_GT(cc.getCwnd(), cwnd + 30.0);
+  BOOST_CHECK_EQUAL(cc.getSsthresh(), std::numeric_limits<double>::max());
+}
+
+BOOST_AUTO_TEST_CASE(BbrSteadyState)
+{
+  BbrCongestionControl cc;
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 1.0);
+  BOOST_CHECK(cc.isInStartup());
+
+  // 1000 segments per second over a path with 50ms propagation delay: BDP is 50 segments
+  deliver(cc, 1_ms, 1_s, 50_ms);
+  BOOST_CHECK(!cc.isInStartup());
+  BOOST_CHECK_EQUAL(cc.getMinRtt(), 50_ms);
+  BOOST_CHECK_CLOSE(cc.getBandwidth(), 1000.0, 1.0);
+
+  // the window cycles around twice the BDP
+  double minCwnd = std::numeric_limits<double>::max();
+  double maxCwnd = 0.0;
+  for (int i = 0; i < 500; ++i) {
+    deliver(cc, 1_ms, 1_ms, 50_ms);
+    minCwnd = std::min(minCwnd, cc.getCwnd());
+    maxCwnd = std::max(maxCwnd, cc.getCwnd());
+  }
+  BOOST_CHECK_CLOSE(minCwnd, 75.0, 1.0);
+  BOOST_CHECK_CLOSE(maxCwnd, 125.0, 1.0);
+
+  // losses do not reduce the window outside of startup
+  double cwnd = cc.getCwnd();
+  cc.afterCongestionEvent();
+  BOOST_CHECK_EQUAL(cc.getCwnd(), cwnd);
+}
+
+BOOST_AUTO_TEST_CASE(BbrLossEndsStartup)
+{
+  BbrCongestionControl cc;
+  deliver(cc, 1_ms, 120_ms, 50_ms);
+  BOOST_CHECK(cc.isInStartup());
+
+  // the window is derived from the path model as soon as startup ends
+  cc.afterCongestionEvent();
+  BOOST_CHECK(!cc.isInStartup());
+  BOOST_CHECK_CLOSE(cc.getCwnd(), BbrCongestionControl::CWND_GAIN *
+                                  BbrCongestionControl::PROBE_GAINS[0] * 1000.0 * 0.05, 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(BbrLossWithoutModel)
+{
+  BbrCongestionControl cc;
+  for (int i = 0; i < 20; ++i) {
+    cc.afterReceiveData(std::nullopt);
+  }
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 21.0);
+
+  cc.afterCongestionEvent();
+  BOOST_CHECK(!cc.isInStartup());
+  BOOST_CHECK_EQUAL(cc.getCwnd(), 10.5);
+}
+
+BOOST_AUTO_TEST_CASE(BbrZeroRtt)
+{
+  BbrCongestionControl cc;
+  // a burst of zero RTT samples, without any time elapsing
+  for (int i = 0; i < 100; ++i) {
+    cc.afterReceiveData(0_ns);
+  }
+  BOOST_CHECK_EQUAL(cc.getMinRtt(), 0_ns);
+  BOOST_CHECK(std::isfinite(cc.getBandwidth()));
+
+  // the zero RTT sample expires from the window, and the model is rebuilt from later samples
+  cc.afterCongestionEvent();
+  deliver(cc, 1_ms, BbrCongestionControl::MIN_RTT_WINDOW + 1_s, 50_ms);
+  BOOST_CHECK_EQUAL(cc.getMinRtt(), 50_ms);
+  BOOST_CHECK(std::isfinite(cc.getCwnd()));
+  BOOST_CHECK_CLOSE(cc.getBandwidth(), 1000.0, 1.0);
+  BOOST_CHECK_LE(cc.getCwnd(), BbrCongestionControl::CWND_GAIN *
+                               BbrCongestionControl::PROBE_GAINS[0] * 1000.0 * 0.05 * 1.01);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCongestionControl
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace ndn::tests
@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/counters.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn::tests {
+
+using ndn::util::Counter;
+using ndn::util::LatencyHistogram;
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_AUTO_TEST_SUITE(TestCounters)
+
+BOOST_AUTO_TEST_CASE(CounterBasic)
+{
+  Counter c;
+  BOOST_CHECK_EQUAL(c.get(), 0);
+
+  ++c;
+  c += 41;
+  BOOST_CHECK_EQUAL(c.get(), 42);
+  BOOST_CHECK_EQUAL(static_cast<uint64_t>(c), 42);
+
+  c.reset();
+  BOOST_CHECK_EQUAL(c.get(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(HistogramBuckets)
+{
+  LatencyHistogram h;
+  BOOST_CHECK_EQUAL(h.getCount(), 0);
+  BOOST_CHECK_EQUAL(h.getQuantile(0.5), 0_ns);
+
+  h.add(500_ns);  // bucket 0
+  h.add(-1_ms);   // negative samples are clamped to zero
+  h.add(3_us);    // bucket 1: [2us, 4us)
+  h.add(1_ms);    // bucket 9: [512us, 1024us)
+  h.add(1025_us); // bucket 10: [1024us, 2048us)
+  h.add(1_h);     // last bucket
+
+  BOOST_CHECK_EQUAL(h.getCount(), 6);
+  BOOST_CHECK_EQUAL(h.getSum(), 500_ns + 3_us + 1_ms + 1025_us + 1_h);
+  BOOST_CHECK_EQUAL(h.getBucketCount(0), 2);
+  BOOST_CHECK_EQUAL(h.getBucketCount(1), 1);
+  BOOST_CHECK_EQUAL(h.getBucketCount(9), 1);
+  BOOST_CHECK_EQUAL(h.getBucketCount(10), 1);
+  BOOST_CHECK_EQUAL(h.getBucketCount(LatencyHistogram::N_BUCKETS - 1), 1);
+
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketUpperBound(0), 2_us);
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketUpperBound(9), 1024_us);
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucketUpperBound(LatencyHistogram::N_BUCKETS - 1),
+                    time::nanoseconds::max());
+
+  BOOST_CHECK_EQUAL(h.getQuantile(0.0), 2_us);
+  BOOST_CHECK_EQUAL(h.getQuantile(0.5), 4_us);
+  BOOST_CHECK_EQUAL(h.getQuantile(0.8), 2048_us);
+  BOOST_CHECK_EQUAL(h.getQuantile(1.0), time::nanoseconds::max());
+
+  h.reset();
+  BOOST_CHECK_EQUAL(h.getCount(), 0);
+  BOOST_CHECK_EQUAL(h.getSum(), 0_ns);
+  BOOST_CHECK_EQUAL(h.getBucketCount(0), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCounters
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace ndn::tests
@@ -0,0 +1,360 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/fetch-manager.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/lp/tags.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+#include "ndn-cxx/util/segmenter.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/unit/dummy-validator.hpp"
+#include "tests/unit/io-key-chain-fixture.hpp"
+
+namespace ndn::tests {
+
+class FetchManagerFixture : public IoKeyChainFixture
+{
+public:
+  /**
+   * \brief Reply to \p interest with a segment of a 10-segment object.
+   */
+  void
+  reply(const Interest& interest, bool hasCongestionMark = false)
+  {
+    Name name = interest.getName();
+    if (name[-1].isSegment()) {
+      name = name.getPrefix(-1);
+    }
+    else {
+      name.appendVersion(1);
+    }
+    uint64_t segment = interest.getName()[-1].isSegment() ? interest.getName()[-1].toSegment() : 0;
+
+    auto data = makeData(Name(name).appendSegment(segment));
+    data->setContent("Hello, world!\0"sv);
+    if (segment == N_SEGMENTS - 1) {
+      data->setFinalBlock(data->getName()[-1]);
+    }
+    if (hasCongestionMark) {
+      data->setTag(make_shared<lp::CongestionMarkTag>(1));
+    }
+    face.receive(*data);
+    advanceClocks(1_ms);
+  }
+
+  /**
+   * \brief Reply to the Interests sent so far.
+   * \return the Interests that have been replied to
+   */
+  std::vector<Interest>
+  replyAll()
+  {
+    auto interests = std::exchange(face.sentInterests, {});
+    for (const auto& interest : interests) {
+      reply(interest);
+      maxOutstanding = std::max(maxOutstanding, manager->getNOutstanding());
+    }
+    return interests;
+  }
+
+  void
+  makeManager(const FetchManager::Options& options)
+  {
+    manager = make_unique<FetchManager>(face, validator, options);
+  }
+
+  shared_ptr<SegmentFetcher>
+  fetch(const Name& name, int priority = 0)
+  {
+    auto fetcher = manager->fetch(Interest(name), priority);
+    fetcher->onComplete.connect([this] (auto&&...) { ++nCompletions; });
+    fetcher->onError.connect([this] (auto&&...) { ++nErrors; });
+    advanceClocks(1_ms);
+    return fetcher;
+  }
+
+public:
+  static constexpr uint64_t N_SEGMENTS = 10;
+
+  DummyClientFace face{m_io, m_keyChain};
+  DummyValidator validator;
+  unique_ptr<FetchManager> manager;
+  int64_t maxOutstanding = 0;
+  int nCompletions = 0;
+  int nErrors = 0;
+};
+
+static size_t
+countInterests(const std::vector<Interest>& interests, const Name& prefix)
+{
+  return std::count_if(interests.begin(), interests.end(),
+                       [&] (const auto& interest) { return prefix.isPrefixOf(interest.getName()); });
+}
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_FIXTURE_TEST_SUITE(TestFetchManager, FetchManagerFixture)
+
+BOOST_AUTO_TEST_CASE(InvalidOptions)
+{
+  FetchManager::Options options;
+  options.maxInFlight = 0;
+  BOOST_CHECK_THROW(FetchManager(face, validator, options), std::invalid_argument);
+
+  options.maxInFlight = 1;
+  options.fetcherOptions.initCwnd = 0.0;
+  BOOST_CHECK_THROW(FetchManager(face, validator, options), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(SharedWindow)
+{
+  FetchManager::Options options;
+  options.fetcherOptions.useConstantCwnd = true;
+  options.fetcherOptions.initCwnd = 4.0;
+  makeManager(options);
+
+  fetch("/A");
+  fetch("/B");
+  fetch("/C");
+  BOOST_CHECK_EQUAL(manager->getNFetchers(), 3);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 3);
+  BOOST_CHECK_EQUAL(manager->getNOutstanding(), 3);
+
+  // once the versions are known, the objects take turns within a single window of 4
+  replyAll();
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(manager->getNOutstanding(), 4);
+  BOOST_CHECK_GE(countInterests(face.sentInterests, "/A"), 1);
+  BOOST_CHECK_GE(countInterests(face.sentInterests, "/B"), 1);
+  BOOST_CHECK_GE(countInterests(face.sentInterests, "/C"), 1);
+
+  for (int i = 0; i < 100 && !face.sentInterests.empty(); ++i) {
+    replyAll();
+  }
+  BOOST_CHECK_EQUAL(nCompletions, 3);
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(maxOutstanding, 4);
+  BOOST_CHECK_EQUAL(manager->getNFetchers(), 0);
+  BOOST_CHECK_EQUAL(manager->getNOutstanding(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MaxInFlight)
+{
+  FetchManager::Options options;
+  options.fetcherOptions.useConstantCwnd = true;
+  options.fetcherOptions.initCwnd = 100.0;
+  options.maxInFlight = 5;
+  makeManager(options);
+
+  fetch("/A");
+  fetch("/B");
+  replyAll();
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 5);
+  BOOST_CHECK_EQUAL(manager->getNOutstanding(), 5);
+
+  for (int i = 0; i < 100 && !face.sentInterests.empty(); ++i) {
+    replyAll();
+  }
+  BOOST_CHECK_EQUAL(nCompletions, 2);
+  BOOST_CHECK_EQUAL(maxOutstanding, 5);
+}
+
+BOOST_AUTO_TEST_CASE(Manifest)
+{
+  Segmenter segmenter(m_keyChain, signingByIdentity(m_keyChain.createIdentity("/producer")));
+  // 10 segments, whose manifest fits in one segment
+  auto packets = segmenter.segmentWithManifest(std::vector<uint8_t>(5000), "/M/v=1", 500, 1_s);
+  std::map<Name, shared_ptr<Data>> published;
+  for (const auto& data : packets) {
+    published.emplace(data->getName(), data);
+  }
+
+  FetchManager::Options options;
+  options.fetcherOptions.useConstantCwnd = true;
+  options.fetcherOptions.initCwnd = 100.0;
+  options.fetcherOptions.useManifest = true;
+  options.fetcherOptions.probeLatestVersion = false;
+  options.maxInFlight = 3;
+  makeManager(options);
+
+  size_t nManifestInterests = 0;
+  size_t maxFetchers = 0;
+  face.onSendInterest.connect([&] (const Interest& interest) {
+    if (interest.getName().size() > 2 && interest.getName()[2] == Segmenter::getManifestComponent()) {
+      ++nManifestInterests;
+    }
+    maxFetchers = std::max(maxFetchers, manager->getNFetchers());
+  });
+
+  fetch("/M/v=1");
+  for (int i = 0; i < 100 && !face.sentInterests.empty(); ++i) {
+    auto interests = std::exchange(face.sentInterests, {});
+    for (const auto& interest : interests) {
+      auto it = published.find(interest.getName());
+      if (it == published.end()) {
+        it = published.find(Name(interest.getName()).appendSegment(0));
+      }
+      BOOST_REQUIRE(it != published.end());
+      face.receive(*it->second);
+      advanceClocks(1_ms);
+      maxOutstanding = std::max(maxOutstanding, manager->getNOutstanding());
+    }
+  }
+
+  // the manifest is fetched by the manager, within the shared limit
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_GE(nManifestInterests, 1);
+  BOOST_CHECK_EQUAL(maxFetchers, 2);
+  BOOST_CHECK_LE(maxOutstanding, 3);
+  BOOST_CHECK_EQUAL(manager->getNFetchers(), 0);
+  BOOST_CHECK_EQUAL(manager->getNOutstanding(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Fair)
+{
+  FetchManager::Options options;
+  options.fetcherOptions.useConstantCwnd = true;
+  options.fetcherOptions.initCwnd = 2.0;
+  options.scheduling = FetchManager::Scheduling::FAIR;
+  makeManager(options);
+
+  fetch("/low", 0);
+  fetch("/high", 1);
+  replyAll();
+
+  // priorities are ignored
+  std::vector<Interest> sent;
+  for (int i = 0; i < 100 && !face.sentInterests.empty(); ++i) {
+    auto interests = replyAll();
+    sent.insert(sent.end(), interests.begin(), interests.end());
+  }
+  BOOST_CHECK_EQUAL(nCompletions, 2);
+  BOOST_REQUIRE_GE(sent.size(), 2 * (N_SEGMENTS - 1));
+  BOOST_CHECK_GE(countInterests({sent.begin(), sent.begin() + N_SEGMENTS}, "/low"), 4);
+  BOOST_CHECK_GE(countInterests({sent.begin(), sent.begin() + N_SEGMENTS}, "/high"), 4);
+}
+
+BOOST_AUTO_TEST_CASE(Priority)
+{
+  FetchManager::Options options;
+  options.fetcherOptions.useConstantCwnd = true;
+  options.fetcherOptions.initCwnd = 2.0;
+  options.scheduling = FetchManager::Scheduling::PRIORITY;
+  makeManager(options);
+
+  fetch("/low", 0);
+  fetch("/high", 1);
+  // the first Interests of both objects fit in the window
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+  replyAll();
+
+  // the high-priority object takes the whole window while it has segments to request
+  std::vector<Interest> sent;
+  for (int i = 0; i < 100 && !face.sentInterests.empty(); ++i) {
+    auto interests = replyAll();
+    sent.insert(sent.end(), interests.begin(), interests.end());
+  }
+  BOOST_CHECK_EQUAL(nCompletions, 2);
+  auto isHigh = [] (const Interest& interest) { return Name("/high").isPrefixOf(interest.getName()); };
+  auto firstHigh = std::find_if(sent.begin(), sent.end(), isHigh);
+  auto lastHigh = std::find_if(sent.rbegin(), sent.rend(), isHigh).base();
+  BOOST_REQUIRE(firstHigh < lastHigh);
+  BOOST_CHECK_EQUAL(countInterests({firstHigh, lastHigh}, "/high"), N_SEGMENTS);
+  BOOST_CHECK_EQUAL(countInterests({firstHigh, lastHigh}, "/low"), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ConservativeWindowAdaptation)
+{
+  FetchManager::Options options;
+  options.fetcherOptions.initCwnd = 8.0;
+  options.fetcherOptions.initSsthresh = 8.0;
+  options.fetcherOptions.aiStep = 0.0;
+  makeManager(options);
+
+  fetch("/A");
+  fetch("/B");
+  replyAll();
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 8);
+  double cwnd = manager->getCongestionControl().getCwnd();
+
+  // congestion marks on Interests of both objects sent in the same round trip
+  // decrease the shared window only once
+  auto interests = std::exchange(face.sentInterests, {});
+  auto b = std::find_if(interests.begin(), interests.end(),
+                        [] (const auto& interest) { return Name("/B").isPrefixOf(interest.getName()); });
+  BOOST_REQUIRE(b != interests.end());
+  BOOST_REQUIRE(b != interests.begin());
+  reply(interests.front(), true);
+  BOOST_CHECK_EQUAL(manager->getCongestionControl().getCwnd(), cwnd / 2);
+  reply(*b, true);
+  BOOST_CHECK_EQUAL(manager->getCongestionControl().getCwnd(), cwnd / 2);
+  for (auto it = interests.begin() + 1; it != interests.end(); ++it) {
+    if (it != b) {
+      reply(*it);
+    }
+  }
+
+  // an Interest sent after the window decrease can trigger another one
+  BOOST_REQUIRE(!face.sentInterests.empty());
+  reply(face.sentInterests.back(), true);
+  BOOST_CHECK_EQUAL(manager->getCongestionControl().getCwnd(), cwnd / 4);
+}
+
+BOOST_AUTO_TEST_CASE(StopFetcher)
+{
+  FetchManager::Options options;
+  options.fetcherOptions.useConstantCwnd = true;
+  options.fetcherOptions.initCwnd = 2.0;
+  makeManager(options);
+
+  auto a = fetch("/A");
+  fetch("/B");
+  replyAll();
+  BOOST_CHECK_EQUAL(manager->getNOutstanding(), 2);
+
+  // the window used by a stopped fetcher is handed over to the others
+  a->stop();
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(manager->getNFetchers(), 1);
+  BOOST_CHECK_EQUAL(manager->getNOutstanding(), 2);
+  BOOST_CHECK_EQUAL(countInterests(face.sentInterests, "/B"), 2);
+}
+
+BOOST_AUTO_TEST_CASE(DestroyManager)
+{
+  makeManager({});
+  auto fetcher = fetch("/A");
+  replyAll();
+  BOOST_CHECK_GT(face.sentInterests.size(), 0);
+
+  face.sentInterests.clear();
+  manager.reset();
+  advanceClocks(10_s);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 0);
+  BOOST_CHECK_EQUAL(nCompletions, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFetchManager
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace ndn::tests
@@ -0,0 +1,211 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/lazy-segmenter.hpp"
+#include "ndn-cxx/util/segmenter.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/key-chain-fixture.hpp"
+#include "tests/test-common.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace ndn::tests {
+
+class LazySegmenterFixture : public KeyChainFixture
+{
+public:
+  LazySegmenterFixture()
+  {
+    for (size_t i = 0; i < 2500; ++i) {
+      content.push_back(static_cast<char>(i % 251));
+    }
+    input.str(content);
+  }
+
+public:
+  std::string content;
+  std::istringstream input;
+  security::SigningInfo signingInfo;
+};
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_FIXTURE_TEST_SUITE(TestLazySegmenter, LazySegmenterFixture)
+
+BOOST_AUTO_TEST_CASE(Invalid)
+{
+  BOOST_CHECK_THROW(LazySegmenter(m_keyChain, signingInfo, input, "/foo", 0, 1_s), std::invalid_argument);
+  BOOST_CHECK_THROW(LazySegmenter(m_keyChain, signingInfo, input, "/foo", 100, -1_s), std::invalid_argument);
+
+  std::istringstream bad;
+  bad.setstate(std::ios::failbit);
+  BOOST_CHECK_THROW(LazySegmenter(m_keyChain, signingInfo, bad, "/foo", 100, 1_s), LazySegmenter::Error);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyInput)
+{
+  std::istringstream empty;
+  LazySegmenter segmenter(m_keyChain, signingInfo, empty, "/empty", 1000, 1_s, tlv::ContentType_Nack);
+  BOOST_TEST(segmenter.getObjectSize() == 0);
+  BOOST_TEST(segmenter.getNSegments() == 1);
+
+  auto data = segmenter.getSegment(0);
+  BOOST_REQUIRE(data != nullptr);
+  BOOST_TEST(data->getName() == "/empty/seg=0");
+  BOOST_TEST(data->getContentType() == tlv::ContentType_Nack);
+  BOOST_TEST(data->getFinalBlock().value() == name::Component::fromSegment(0));
+  BOOST_TEST(data->getContent().value_size() == 0);
+  BOOST_TEST(segmenter.getSegment(1) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(SameAsSegmenter)
+{
+  Segmenter eager(m_keyChain, signingInfo);
+  std::istringstream eagerInput(content);
+  auto expected = eager.segment(eagerInput, "/obj", 1000, 1_s);
+
+  LazySegmenter segmenter(m_keyChain, signingInfo, input, "/obj", 1000, 1_s);
+  BOOST_TEST(segmenter.getName() == "/obj");
+  BOOST_TEST(segmenter.getObjectSize() == content.size());
+  BOOST_REQUIRE_EQUAL(segmenter.getNSegments(), expected.size());
+
+  // in reverse order, to exercise seeking
+  for (auto i = static_cast<int>(expected.size()) - 1; i >= 0; --i) {
+    auto data = segmenter.getSegment(static_cast<uint64_t>(i));
+    BOOST_REQUIRE(data != nullptr);
+    BOOST_TEST(data->getName() == expected[i]->getName());
+    BOOST_TEST(data->getFinalBlock().value() == expected[i]->getFinalBlock().value());
+    BOOST_TEST(data->getFreshnessPeriod() == 1_s);
+    BOOST_TEST(data->getContent() == expected[i]->getContent(), boost::test_tools::per_element());
+  }
+  BOOST_TEST(segmenter.getSegment(expected.size()) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(StartPosition)
+{
+  input.seekg(500);
+  LazySegmenter segmenter(m_keyChain, signingInfo, input, "/obj", 1000, 1_s);
+  BOOST_TEST(segmenter.getObjectSize() == 2000);
+  BOOST_TEST(segmenter.getNSegments() == 2);
+
+  auto data = segmenter.getSegment(0);
+  BOOST_REQUIRE(data != nullptr);
+  BOOST_TEST(data->getContent().value()[0] == static_cast<uint8_t>(content[500]));
+}
+
+BOOST_AUTO_TEST_CASE(Lazy)
+{
+  LazySegmenter segmenter(m_keyChain, signingInfo, input, "/obj", 100, 1_s);
+  BOOST_TEST(segmenter.getNSegments() == 25);
+  BOOST_TEST(segmenter.getNCachedSegments() == 0);
+
+  auto data = segmenter.getSegment(3);
+  BOOST_TEST(segmenter.getNCachedSegments() == 1);
+  BOOST_TEST(segmenter.getSegment(3) == data); // cached
+
+  segmenter.setReadAhead(4);
+  segmenter.getSegment(10);
+  BOOST_TEST(segmenter.getNCachedSegments() == 6);
+
+  // near the end, read-ahead stops at the last segment
+  segmenter.getSegment(23);
+  BOOST_TEST(segmenter.getNCachedSegments() == 8);
+
+  segmenter.setCacheLimit(2);
+  BOOST_TEST(segmenter.getNCachedSegments() == 5); // read-ahead window plus one
+
+  segmenter.setReadAhead(0);
+  segmenter.getSegment(0);
+  BOOST_TEST(segmenter.getNCachedSegments() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(EvictLeastRecentlyUsed)
+{
+  LazySegmenter segmenter(m_keyChain, signingInfo, input, "/obj", 100, 1_s);
+  segmenter.setCacheLimit(3);
+  auto seg0 = segmenter.getSegment(0);
+  auto seg1 = segmenter.getSegment(1);
+  segmenter.getSegment(2);
+  BOOST_TEST(segmenter.getNCachedSegments() == 3);
+
+  // segment 0 is requested again after the cache is full, so segment 1 is evicted instead
+  BOOST_TEST(segmenter.getSegment(0) == seg0);
+  segmenter.getSegment(3);
+  BOOST_TEST(segmenter.getNCachedSegments() == 3);
+  BOOST_TEST(segmenter.getSegment(0) == seg0);
+  BOOST_TEST(segmenter.getSegment(1) != seg1);
+}
+
+BOOST_AUTO_TEST_CASE(File)
+{
+  namespace fs = std::filesystem;
+  const fs::path dir = fs::path(UNIT_TESTS_TMPDIR) / "TestLazySegmenter";
+  fs::create_directories(dir);
+  const auto filename = (dir / "content").string();
+  {
+    std::ofstream os(filename, std::ios::binary);
+    os << content;
+  }
+
+  LazySegmenter fromStream(m_keyChain, signingInfo, input, "/obj", 1000, 1_s);
+  LazySegmenter fromFile(m_keyChain, signingInfo, filename, "/obj", 1000, 1_s);
+  BOOST_TEST(fromFile.getObjectSize() == content.size());
+  BOOST_REQUIRE_EQUAL(fromFile.getNSegments(), fromStream.getNSegments());
+  for (uint64_t i = 0; i < fromFile.getNSegments(); ++i) {
+    auto expected = fromStream.getSegment(i);
+    auto data = fromFile.getSegment(i);
+    BOOST_REQUIRE(data != nullptr);
+    BOOST_TEST(data->getName() == expected->getName());
+    BOOST_TEST(data->getContent() == expected->getContent(), boost::test_tools::per_element());
+  }
+
+  BOOST_CHECK_THROW(LazySegmenter(m_keyChain, signingInfo, (dir / "missing").string(),
+                                  "/obj", 1000, 1_s),
+                    LazySegmenter::Error);
+
+  fs::remove_all(dir);
+}
+
+BOOST_AUTO_TEST_CASE(Find)
+{
+  LazySegmenter segmenter(m_keyChain, signingInfo, input, "/obj/v=1", 1000, 1_s);
+
+  auto data = segmenter.find(*makeInterest("/obj/v=1/seg=2"));
+  BOOST_REQUIRE(data != nullptr);
+  BOOST_TEST(data->getName() == "/obj/v=1/seg=2");
+
+  // discovery Interest
+  data = segmenter.find(*makeInterest("/obj", true));
+  BOOST_REQUIRE(data != nullptr);
+  BOOST_TEST(data->getName() == "/obj/v=1/seg=0");
+
+  BOOST_TEST(segmenter.find(*makeInterest("/obj")) == nullptr);
+  BOOST_TEST(segmenter.find(*makeInterest("/obj/v=1/seg=3")) == nullptr);
+  BOOST_TEST(segmenter.find(*makeInterest("/obj/v=2/seg=0")) == nullptr);
+  BOOST_TEST(segmenter.find(*makeInterest("/other", true)) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLazySegmenter
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace ndn::tests
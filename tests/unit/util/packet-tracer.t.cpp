@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/packet-tracer.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/unit/io-key-chain-fixture.hpp"
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+namespace ndn::tests {
+
+using ndn::util::PacketTraceEvent;
+using ndn::util::PacketTracer;
+
+class PacketTracerFixture : public IoKeyChainFixture
+{
+protected:
+  PacketTracerFixture()
+  {
+    PacketTracer::enable(16);
+  }
+
+  ~PacketTracerFixture() override
+  {
+    PacketTracer::disable();
+  }
+
+protected:
+  DummyClientFace face{m_io, m_keyChain};
+};
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_FIXTURE_TEST_SUITE(TestPacketTracer, PacketTracerFixture)
+
+BOOST_AUTO_TEST_CASE(RecordAndDump)
+{
+  PacketTracer::record(PacketTraceEvent::OUT_INTEREST, "/A", 10, 1);
+  PacketTracer::record(PacketTraceEvent::TRANSPORT_SEND, 20);
+  PacketTracer::disable();
+  PacketTracer::record(PacketTraceEvent::OUT_DATA, "/B", 30);
+
+  auto records = PacketTracer::snapshot();
+  BOOST_REQUIRE_EQUAL(records.size(), 2);
+  BOOST_CHECK(records[0].event == PacketTraceEvent::OUT_INTEREST);
+  BOOST_CHECK_EQUAL(records[0].nameHash, std::hash<Name>{}("/A"));
+  BOOST_CHECK_EQUAL(records[0].size, 10);
+  BOOST_CHECK_EQUAL(records[0].pitId, 1);
+  BOOST_CHECK(records[1].event == PacketTraceEvent::TRANSPORT_SEND);
+  BOOST_CHECK_EQUAL(records[1].nameHash, 0);
+  BOOST_CHECK_EQUAL(records[1].size, 20);
+
+  std::stringstream ss;
+  PacketTracer::dump(ss);
+  auto loaded = PacketTracer::load(ss);
+  BOOST_REQUIRE_EQUAL(loaded.size(), 2);
+  BOOST_CHECK_EQUAL(loaded[1].size, 20);
+
+  std::istringstream bad("not a trace file");
+  BOOST_CHECK_THROW(PacketTracer::load(bad), PacketTracer::Error);
+}
+
+BOOST_AUTO_TEST_CASE(RingOverwrite)
+{
+  for (uint32_t i = 0; i < 20; ++i) {
+    PacketTracer::record(PacketTraceEvent::TRANSPORT_RECV, i);
+  }
+
+  auto records = PacketTracer::snapshot();
+  BOOST_REQUIRE_EQUAL(records.size(), 16);
+  BOOST_CHECK_EQUAL(records.front().size, 4);
+  BOOST_CHECK_EQUAL(records.back().size, 19);
+
+  PacketTracer::enable(16);
+  BOOST_CHECK_EQUAL(PacketTracer::snapshot().size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MultipleThreads)
+{
+  PacketTracer::record(PacketTraceEvent::TRANSPORT_RECV, 1);
+  std::thread([] {
+    PacketTracer::record(PacketTraceEvent::TRANSPORT_RECV, 2);
+  }).join();
+
+  auto records = PacketTracer::snapshot();
+  BOOST_REQUIRE_EQUAL(records.size(), 2);
+  BOOST_CHECK_NE(records[0].thread, records[1].thread);
+}
+
+BOOST_AUTO_TEST_CASE(SnapshotWhileRecording)
+{
+  std::atomic<bool> isDone{false};
+  std::thread writer([&] {
+    for (uint32_t i = 1; i <= 200000; ++i) {
+      PacketTracer::record(PacketTraceEvent::OUT_INTEREST, Name(), i, i);
+    }
+    isDone = true;
+  });
+
+  size_t nTorn = 0;
+  while (!isDone) {
+    for (const auto& record : PacketTracer::snapshot()) {
+      if (record.pitId != record.size) {
+        ++nTorn;
+      }
+    }
+  }
+  writer.join();
+  BOOST_CHECK_EQUAL(nTorn, 0);
+  BOOST_CHECK_EQUAL(PacketTracer::snapshot().size(), 16);
+}
+
+BOOST_AUTO_TEST_CASE(FaceEvents)
+{
+  face.expressInterest(*makeInterest("/A", false, 50_ms), nullptr, nullptr, nullptr);
+  face.expressInterest(*makeInterest("/B", false, 50_ms), nullptr, nullptr, nullptr);
+  advanceClocks(1_ms);
+  face.receive(*makeData("/A"));
+  advanceClocks(50_ms);
+
+  auto records = PacketTracer::snapshot();
+  BOOST_REQUIRE_EQUAL(records.size(), 5);
+  BOOST_CHECK(records[0].event == PacketTraceEvent::OUT_INTEREST);
+  BOOST_CHECK(records[1].event == PacketTraceEvent::OUT_INTEREST);
+  BOOST_CHECK(records[2].event == PacketTraceEvent::IN_DATA);
+  BOOST_CHECK(records[3].event == PacketTraceEvent::SATISFIED);
+  BOOST_CHECK_EQUAL(records[3].pitId, records[0].pitId);
+  BOOST_CHECK(records[4].event == PacketTraceEvent::TIMED_OUT);
+  BOOST_CHECK_EQUAL(records[4].pitId, records[1].pitId);
+  BOOST_CHECK_EQUAL(records[4].nameHash, std::hash<Name>{}("/B"));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPacketTracer
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace ndn::tests
@@ -75,6 +75,19 @@ BOOST_AUTO_TEST_CASE(NegativeDelay)
   BOOST_CHECK(wasCallbackInvoked);
 }
 
+BOOST_AUTO_TEST_CASE(MoveOnlyCallback)
+{
+  auto value = std::make_unique<int>(42);
+  int result = 0;
+  scheduler.schedule(10_ms, [&result, value = std::move(value)] { result = *value; });
+
+  EventCallback copyable = [&result] { ++result; };
+  scheduler.schedule(20_ms, copyable);
+
+  advanceClocks(5_ms, 5);
+  BOOST_CHECK_EQUAL(result, 43);
+}
+
 BOOST_AUTO_TEST_CASE(ThrowingCallback)
 {
   class MyException : public std::exception
@@ -212,6 +225,45 @@ BOOST_AUTO_TEST_CASE(CancelAllWithScopedEventId,
   BOOST_CHECK(true);
 }
 
+BOOST_AUTO_TEST_CASE(TimerSlack)
+{
+  BOOST_CHECK_EQUAL(scheduler.getTimerSlack(), 0_ns);
+  BOOST_CHECK_THROW(scheduler.setTimerSlack(-1_ms), std::invalid_argument);
+  scheduler.setTimerSlack(10_ms);
+  BOOST_CHECK_EQUAL(scheduler.getTimerSlack(), 10_ms);
+
+  auto t0 = time::steady_clock::now();
+  std::vector<std::pair<int, time::nanoseconds>> fired;
+  auto makeCallback = [&] (int id) {
+    return [&fired, &t0, id] { fired.emplace_back(id, time::steady_clock::now() - t0); };
+  };
+
+  scheduler.schedule(9_ms, makeCallback(3));
+  scheduler.schedule(1_ms, makeCallback(1));
+  scheduler.schedule(5_ms, makeCallback(2));
+  scheduler.schedule(12_ms, makeCallback(4));
+  EventId eid = scheduler.schedule(30_ms, makeCallback(0));
+  scheduler.schedule(35_ms, makeCallback(5));
+
+  advanceClocks(1_ms, 25);
+  eid.cancel();
+  advanceClocks(1_ms, 35);
+
+  // 1, 2, and 3 fire together at the deadline of the first event, 4 gets its own wake-up,
+  // and 5 fires at the deadline armed for the canceled event, which is within its slack
+  BOOST_REQUIRE_EQUAL(fired.size(), 5);
+  BOOST_CHECK_EQUAL(fired[0].first, 1);
+  BOOST_CHECK_EQUAL(fired[0].second, 11_ms);
+  BOOST_CHECK_EQUAL(fired[1].first, 2);
+  BOOST_CHECK_EQUAL(fired[1].second, 11_ms);
+  BOOST_CHECK_EQUAL(fired[2].first, 3);
+  BOOST_CHECK_EQUAL(fired[2].second, 11_ms);
+  BOOST_CHECK_EQUAL(fired[3].first, 4);
+  BOOST_CHECK_EQUAL(fired[3].second, 22_ms);
+  BOOST_CHECK_EQUAL(fired[4].first, 5);
+  BOOST_CHECK_EQUAL(fired[4].second, 40_ms);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // General
 
 BOOST_AUTO_TEST_SUITE(EventId)
@@ -288,6 +340,70 @@ BOOST_AUTO_TEST_CASE(DuringCallback)
   BOOST_CHECK(isCallbackInvoked);
 }
 
+BOOST_AUTO_TEST_CASE(StaleAfterReuse)
+{
+  // a canceled or expired event releases its node, which is then reused by the next event
+  EventId eid = scheduler.schedule(10_ms, []{});
+  eid.cancel();
+
+  bool isCallbackInvoked = false;
+  EventId eid2 = scheduler.schedule(10_ms, [&isCallbackInvoked] { isCallbackInvoked = true; });
+  BOOST_CHECK(!eid);
+  BOOST_CHECK(eid2);
+  BOOST_CHECK_NE(eid, eid2);
+
+  eid.cancel(); // must not cancel the new event
+  BOOST_CHECK(eid2);
+
+  this->advanceClocks(6_ms, 2);
+  BOOST_CHECK(isCallbackInvoked);
+  BOOST_CHECK(!eid2);
+
+  EventId eid3 = scheduler.schedule(10_ms, []{});
+  eid2.cancel(); // must not cancel the new event
+  BOOST_CHECK(eid3);
+  BOOST_CHECK_NE(eid2, eid3);
+}
+
+BOOST_AUTO_TEST_CASE(ManyEvents)
+{
+  // exercise growth of the event pool
+  const size_t nEvents = 1000;
+  std::vector<EventId> eids;
+  size_t nExecuted = 0;
+  for (size_t i = 0; i < nEvents; ++i) {
+    eids.push_back(scheduler.schedule(time::milliseconds(i % 10 + 1), [&nExecuted] { ++nExecuted; }));
+  }
+  for (size_t i = 0; i < nEvents; i += 2) {
+    eids[i].cancel();
+  }
+  for (size_t i = 0; i < nEvents; ++i) {
+    BOOST_CHECK_EQUAL(static_cast<bool>(eids[i]), i % 2 == 1);
+  }
+
+  this->advanceClocks(1_ms, 20);
+  BOOST_CHECK_EQUAL(nExecuted, nEvents / 2);
+  for (const auto& eid : eids) {
+    BOOST_CHECK(!eid);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AfterSchedulerDestructed)
+{
+  EventId eid;
+  ScopedEventId se;
+  {
+    Scheduler sched(m_io);
+    eid = sched.schedule(10_ms, []{});
+    se = sched.schedule(10_ms, []{});
+    BOOST_CHECK(eid);
+  }
+  BOOST_CHECK(!eid);
+  BOOST_CHECK(eid == EventId{});
+  eid.cancel(); // no effect
+  se.cancel(); // no effect
+}
+
 BOOST_AUTO_TEST_CASE(Reset)
 {
   bool isCallbackInvoked = false;
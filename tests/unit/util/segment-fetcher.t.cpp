@@ -23,16 +23,58 @@
 
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/lp/nack.hpp"
+#include "ndn-cxx/security/certificate-fetcher-offline.hpp"
+#include "ndn-cxx/security/validation-policy-simple-hierarchy.hpp"
 #include "ndn-cxx/util/dummy-client-face.hpp"
+#include "ndn-cxx/util/segmenter.hpp"
 
 #include "tests/test-common.hpp"
 #include "tests/unit/dummy-validator.hpp"
 #include "tests/unit/io-key-chain-fixture.hpp"
 
+#include <queue>
 #include <set>
+#include <thread>
 
 namespace ndn::tests {
 
+/**
+ * \brief A validation policy that accepts all packets, but only when told to.
+ */
+class DeferredValidationPolicy : public security::ValidationPolicy
+{
+public:
+  /**
+   * \brief Complete the validation of the packet passed to the validator \p i -th among those
+   *        still awaiting validation.
+   */
+  void
+  accept(size_t i)
+  {
+    auto continuation = std::move(pending.at(i));
+    pending.erase(pending.begin() + static_cast<ptrdiff_t>(i));
+    continuation();
+  }
+
+protected:
+  void
+  checkPolicy(const Data&, const shared_ptr<security::ValidationState>& state,
+              const ValidationContinuation& continueValidation) final
+  {
+    pending.push_back([=] { continueValidation(nullptr, state); });
+  }
+
+  void
+  checkPolicy(const Interest&, const shared_ptr<security::ValidationState>& state,
+              const ValidationContinuation& continueValidation) final
+  {
+    pending.push_back([=] { continueValidation(nullptr, state); });
+  }
+
+public:
+  std::vector<std::function<void()>> pending;
+};
+
 class SegmentFetcherFixture : public IoKeyChainFixture
 {
 public:
@@ -245,13 +287,13 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
 
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
 
   face.receive(*makeDataSegment("/hello/world/version0", 0, false));
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
   BOOST_CHECK_EQUAL(face.sentInterests.back().getName().get(-1).toSegment(), 1);
@@ -259,7 +301,7 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
   face.receive(*makeDataSegment("/hello/world/version0", 1, false));
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 3);
   BOOST_CHECK_EQUAL(face.sentInterests.back().getName().get(-1).toSegment(), 2);
@@ -267,7 +309,7 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
   face.receive(*makeDataSegment("/hello/world/version0", 2, false));
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 4);
   BOOST_CHECK_EQUAL(face.sentInterests.back().getName().get(-1).toSegment(), 3);
@@ -275,7 +317,7 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
   face.receive(*makeDataSegment("/hello/world/version0", 3, false));
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 5);
   BOOST_CHECK_EQUAL(face.sentInterests.back().getName().get(-1).toSegment(), 4);
@@ -283,7 +325,7 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
 
   advanceClocks(10_ms);
 
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 6);
   BOOST_CHECK_EQUAL(face.sentInterests.back().getName().get(-1).toSegment(), 4);
@@ -297,7 +339,7 @@ BOOST_AUTO_TEST_CASE(ConstantCwnd)
   BOOST_CHECK_EQUAL(nAfterSegmentValidated, 5);
   BOOST_CHECK_EQUAL(nAfterSegmentNacked, 1);
   BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
 }
 
 BOOST_AUTO_TEST_CASE(BasicMultipleSegments)
@@ -330,6 +372,36 @@ BOOST_AUTO_TEST_CASE(BasicMultipleSegments)
   BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
 }
 
+BOOST_AUTO_TEST_CASE(CompleteSegments)
+{
+  DummyValidator acceptValidator;
+  nSegments = 40;
+  segmentsToDropOrNack.push(7);
+
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator);
+  face.onSendInterest.connect(std::bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  std::vector<Block> segments;
+  fetcher->onCompleteSegments.connect([&] (const auto& s) { segments = s; });
+  ConstBufferPtr combined;
+  fetcher->onComplete.connect([&] (ConstBufferPtr buf) { combined = buf; });
+
+  face.processEvents(1_s);
+  advanceClocks(100_ms, 20);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_REQUIRE_EQUAL(segments.size(), 40);
+  BOOST_REQUIRE(combined != nullptr);
+  BOOST_REQUIRE_EQUAL(combined->size(), 14 * 40);
+  auto pos = combined->begin();
+  for (const auto& segment : segments) {
+    BOOST_CHECK_EQUAL(segment.type(), tlv::Content);
+    BOOST_TEST(segment.value_bytes() == make_span(&*pos, 14), boost::test_tools::per_element());
+    pos += 14;
+  }
+}
+
 BOOST_AUTO_TEST_CASE(BasicInOrder)
 {
   DummyValidator acceptValidator;
@@ -355,6 +427,46 @@ BOOST_AUTO_TEST_CASE(BasicInOrder)
   BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
 }
 
+BOOST_AUTO_TEST_CASE(InOrderBoundedMemory)
+{
+  DummyValidator acceptValidator;
+  SegmentFetcher::Options options;
+  options.inOrder = true;
+  options.flowControlBytes = 14 * 4;
+  nSegments = 401;
+  segmentsToDropOrNack.push(0);
+  segmentsToDropOrNack.push(200);
+  sendNackInsteadOfDropping = true;
+  nackReason = lp::NackReason::DUPLICATE;
+
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  face.onSendInterest.connect(std::bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  // the buffer is sampled before each segment is processed and while buffered segments are
+  // being delivered, i.e., after every change caused by the previous segment
+  size_t nContentBytes = 0;
+  size_t maxBufferedBytes = 0;
+  fetcher->onInOrderContent.connect([&] (span<const uint8_t> content) {
+    nContentBytes += content.size();
+    maxBufferedBytes = std::max(maxBufferedBytes, fetcher->m_nBufferedBytes);
+  });
+  fetcher->afterSegmentReceived.connect([&] (const auto&) {
+    maxBufferedBytes = std::max(maxBufferedBytes, fetcher->m_nBufferedBytes);
+  });
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nOnInOrderComplete, 1);
+  BOOST_CHECK_EQUAL(nOnInOrderData, 401);
+  BOOST_CHECK_EQUAL(dataSize, 14 * 401);
+  BOOST_CHECK_EQUAL(nContentBytes, 14 * 401);
+  BOOST_CHECK_GT(maxBufferedBytes, 0);
+  BOOST_CHECK_LE(maxBufferedBytes, options.flowControlBytes);
+  BOOST_CHECK_EQUAL(fetcher->m_nBufferedBytes, 0);
+}
+
 BOOST_AUTO_TEST_CASE(VersionedPrefix)
 {
   DummyValidator acceptValidator;
@@ -456,6 +568,72 @@ BOOST_AUTO_TEST_CASE(FirstSegmentNotZeroInOrder)
   BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
 }
 
+BOOST_AUTO_TEST_CASE(FirstSegmentHuge)
+{
+  DummyValidator acceptValidator;
+  for (uint64_t firstSegment : {uint64_t{1} << 40, std::numeric_limits<uint64_t>::max()}) {
+    BOOST_TEST_CONTEXT("first segment " << firstSegment) {
+      face.sentInterests.clear();
+      auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator);
+      connectSignals(fetcher);
+      advanceClocks(10_ms);
+
+      // the segment is delivered, but does not make the fetcher track every segment before it
+      face.receive(*makeDataSegment("/hello/world/version0", firstSegment, false));
+      advanceClocks(10_ms);
+      BOOST_CHECK_EQUAL(nErrors, 0);
+      BOOST_CHECK_EQUAL(nAfterSegmentValidated, 1);
+      BOOST_REQUIRE_GE(face.sentInterests.size(), 2);
+      BOOST_CHECK_EQUAL(face.sentInterests[1].getName(), "/hello/world/version0/seg=0");
+
+      fetcher->stop();
+      nAfterSegmentValidated = 0;
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(WindowCollapse)
+{
+  DummyValidator acceptValidator;
+  for (bool inOrder : {false, true}) {
+    BOOST_TEST_CONTEXT((inOrder ? "in-order" : "block") << " mode") {
+      face.sentInterests.clear();
+      nErrors = 0;
+      nCompletions = 0;
+
+      SegmentFetcher::Options options;
+      options.inOrder = inOrder;
+      options.initCwnd = 8;
+      options.disableCwa = true;
+      options.flowControlWindow = 1;
+      auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+      connectSignals(fetcher);
+      advanceClocks(10_ms);
+      face.receive(*makeDataSegment("/hello/world/version0", 0, false));
+      advanceClocks(10_ms);
+      uint64_t nRequested = face.sentInterests.size();
+      BOOST_REQUIRE_GE(nRequested, inOrder ? 2 : 8);
+
+      // the window collapses, then the segments requested before arrive, the last ones being
+      // farther ahead of the missing segment than the window and reorder buffer together
+      face.receive(makeNack(face.sentInterests[1], lp::NackReason::CONGESTION));
+      advanceClocks(10_ms);
+      const uint64_t lastSegment = nRequested + 4;
+      signal::ScopedConnection responder = face.onSendInterest.connect([&] (const Interest& i) {
+        auto seg = i.getName()[-1].toSegment();
+        face.receive(*makeDataSegment("/hello/world/version0", seg, seg == lastSegment));
+      });
+      for (uint64_t seg = 2; seg < nRequested; ++seg) {
+        face.receive(*makeDataSegment("/hello/world/version0", seg, false));
+      }
+      advanceClocks(10_ms, 100);
+
+      BOOST_CHECK_EQUAL(nErrors, 0);
+      BOOST_CHECK_EQUAL(nCompletions, 1);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(WindowSize)
 {
   DummyValidator acceptValidator;
@@ -466,10 +644,10 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   advanceClocks(10_ms); // T+10ms
 
   BOOST_CHECK_EQUAL(fetcher->m_timeLastSegmentReceived, time::steady_clock::now() - 10_ms);
-  BOOST_CHECK_EQUAL(fetcher->m_retxQueue.size(), 0);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInRetxQueue, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, 0);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, 1.0);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, std::numeric_limits<double>::max());
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 1.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), std::numeric_limits<double>::max());
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 1);
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 0);
@@ -477,12 +655,12 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   BOOST_CHECK_EQUAL(fetcher->m_highData, 0);
   BOOST_CHECK_EQUAL(fetcher->m_recPoint, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nReceived, 0);
-  BOOST_CHECK_EQUAL(fetcher->m_receivedSegments.size(), 0);
+  BOOST_CHECK_EQUAL(fetcher->m_nReceived, 0);
   BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), 1);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), 1);
 
-  double oldCwnd = fetcher->m_cwnd;
-  double oldSsthresh = fetcher->m_ssthresh;
+  double oldCwnd = fetcher->m_cc->getCwnd();
+  double oldSsthresh = fetcher->m_cc->getSsthresh();
   uint64_t oldNextSegmentNum = fetcher->m_nextSegmentNum;
 
   face.receive(*makeDataSegment("/hello/world/version0", 0, false));
@@ -490,24 +668,24 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   advanceClocks(10_ms); //T+20ms
 
   BOOST_CHECK_EQUAL(fetcher->m_timeLastSegmentReceived, time::steady_clock::now() - 10_ms);
-  BOOST_CHECK_EQUAL(fetcher->m_retxQueue.size(), 0);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInRetxQueue, 0);
   BOOST_CHECK_EQUAL(fetcher->m_versionedDataName, "/hello/world/version0");
   // +2 below because m_nextSegmentNum will be incremented in the receive callback if segment 0 is
   // the first received
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, oldNextSegmentNum + fetcher->m_options.aiStep + 2);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, oldCwnd + fetcher->m_options.aiStep);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, oldSsthresh);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), oldCwnd + fetcher->m_options.aiStep);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), oldSsthresh);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, oldCwnd + fetcher->m_options.aiStep);
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 14);
   BOOST_CHECK_EQUAL(fetcher->m_highInterest, fetcher->m_nextSegmentNum - 1);
   BOOST_CHECK_EQUAL(fetcher->m_highData, 0);
   BOOST_CHECK_EQUAL(fetcher->m_recPoint, 0);
-  BOOST_CHECK_EQUAL(fetcher->m_receivedSegments.size(), 1);
-  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cwnd);
-  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1 + fetcher->m_cwnd);
+  BOOST_CHECK_EQUAL(fetcher->m_nReceived, 1);
+  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cc->getCwnd());
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1 + fetcher->m_cc->getCwnd());
 
-  oldCwnd = fetcher->m_cwnd;
+  oldCwnd = fetcher->m_cc->getCwnd();
   oldNextSegmentNum = fetcher->m_nextSegmentNum;
 
   face.receive(*makeDataSegment("/hello/world/version0", 2, false));
@@ -515,22 +693,22 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   advanceClocks(10_ms); //T+30ms
 
   BOOST_CHECK_EQUAL(fetcher->m_timeLastSegmentReceived, time::steady_clock::now() - 10_ms);
-  BOOST_CHECK_EQUAL(fetcher->m_retxQueue.size(), 0);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInRetxQueue, 0);
   BOOST_CHECK_EQUAL(fetcher->m_versionedDataName, "/hello/world/version0");
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, oldNextSegmentNum + fetcher->m_options.aiStep + 1);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, oldCwnd + fetcher->m_options.aiStep);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, oldSsthresh);
-  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, fetcher->m_cwnd);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), oldCwnd + fetcher->m_options.aiStep);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), oldSsthresh);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, fetcher->m_cc->getCwnd());
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 28);
   BOOST_CHECK_EQUAL(fetcher->m_highInterest, fetcher->m_nextSegmentNum - 1);
   BOOST_CHECK_EQUAL(fetcher->m_highData, 2);
   BOOST_CHECK_EQUAL(fetcher->m_recPoint, 0);
-  BOOST_CHECK_EQUAL(fetcher->m_receivedSegments.size(), 2);
-  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cwnd);
-  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2 + fetcher->m_cwnd);
+  BOOST_CHECK_EQUAL(fetcher->m_nReceived, 2);
+  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cc->getCwnd());
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 2 + fetcher->m_cc->getCwnd());
 
-  oldCwnd = fetcher->m_cwnd;
+  oldCwnd = fetcher->m_cc->getCwnd();
   oldNextSegmentNum = fetcher->m_nextSegmentNum;
 
   face.receive(*makeDataSegment("/hello/world/version0", 1, false));
@@ -538,41 +716,41 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   advanceClocks(10_ms); //T+40ms
 
   BOOST_CHECK_EQUAL(fetcher->m_timeLastSegmentReceived, time::steady_clock::now() - 10_ms);
-  BOOST_CHECK_EQUAL(fetcher->m_retxQueue.size(), 0);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInRetxQueue, 0);
   BOOST_CHECK_EQUAL(fetcher->m_versionedDataName, "/hello/world/version0");
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, oldNextSegmentNum + fetcher->m_options.aiStep + 1);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, oldCwnd + fetcher->m_options.aiStep);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, oldSsthresh);
-  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, fetcher->m_cwnd);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), oldCwnd + fetcher->m_options.aiStep);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), oldSsthresh);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, fetcher->m_cc->getCwnd());
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 42);
   BOOST_CHECK_EQUAL(fetcher->m_highInterest, fetcher->m_nextSegmentNum - 1);
   BOOST_CHECK_EQUAL(fetcher->m_highData, 2);
   BOOST_CHECK_EQUAL(fetcher->m_recPoint, 0);
-  BOOST_CHECK_EQUAL(fetcher->m_receivedSegments.size(), 3);
-  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cwnd);
-  BOOST_CHECK_EQUAL(face.sentInterests.size(), 3 + fetcher->m_cwnd);
+  BOOST_CHECK_EQUAL(fetcher->m_nReceived, 3);
+  BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), fetcher->m_cc->getCwnd());
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 3 + fetcher->m_cc->getCwnd());
 
-  oldCwnd = fetcher->m_cwnd;
-  oldSsthresh = fetcher->m_ssthresh;
+  oldCwnd = fetcher->m_cc->getCwnd();
+  oldSsthresh = fetcher->m_cc->getSsthresh();
   oldNextSegmentNum = fetcher->m_nextSegmentNum;
   size_t oldSentInterestsSize = face.sentInterests.size();
 
   nackLastInterest(lp::NackReason::CONGESTION); //T+50ms
 
   BOOST_CHECK_EQUAL(fetcher->m_timeLastSegmentReceived, time::steady_clock::now() - 20_ms);
-  BOOST_CHECK_EQUAL(fetcher->m_retxQueue.size(), 1);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInRetxQueue, 1);
   BOOST_CHECK_EQUAL(fetcher->m_versionedDataName, "/hello/world/version0");
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, oldNextSegmentNum);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, oldCwnd / 2.0);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, oldCwnd / 2.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), oldCwnd / 2.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), oldCwnd / 2.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, oldCwnd - 1);
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 42);
   BOOST_CHECK_EQUAL(fetcher->m_highInterest, fetcher->m_nextSegmentNum - 1);
   BOOST_CHECK_EQUAL(fetcher->m_highData, 2);
   BOOST_CHECK_EQUAL(fetcher->m_recPoint, fetcher->m_nextSegmentNum - 1);
-  BOOST_CHECK_EQUAL(fetcher->m_receivedSegments.size(), 3);
+  BOOST_CHECK_EQUAL(fetcher->m_nReceived, 3);
   // The Nacked segment will remain in pendingSegments, so the size of the structure doesn't change
   BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), oldCwnd);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), oldSentInterestsSize);
@@ -580,18 +758,18 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   advanceClocks(10_ms); //T+60ms
 
   BOOST_CHECK_EQUAL(fetcher->m_timeLastSegmentReceived, time::steady_clock::now() - 30_ms);
-  BOOST_CHECK_EQUAL(fetcher->m_retxQueue.size(), 1);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInRetxQueue, 1);
   BOOST_CHECK_EQUAL(fetcher->m_versionedDataName, "/hello/world/version0");
   BOOST_CHECK_EQUAL(fetcher->m_nextSegmentNum, oldNextSegmentNum);
-  BOOST_CHECK_EQUAL(fetcher->m_cwnd, oldCwnd / 2.0);
-  BOOST_CHECK_EQUAL(fetcher->m_ssthresh, oldCwnd / 2.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), oldCwnd / 2.0);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getSsthresh(), oldCwnd / 2.0);
   BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, oldCwnd - 1);
   BOOST_CHECK_EQUAL(fetcher->m_nSegments, 0);
   BOOST_CHECK_EQUAL(fetcher->m_nBytesReceived, 42);
   BOOST_CHECK_EQUAL(fetcher->m_highInterest, fetcher->m_nextSegmentNum - 1);
   BOOST_CHECK_EQUAL(fetcher->m_highData, 2);
   BOOST_CHECK_EQUAL(fetcher->m_recPoint, fetcher->m_nextSegmentNum - 1);
-  BOOST_CHECK_EQUAL(fetcher->m_receivedSegments.size(), 3);
+  BOOST_CHECK_EQUAL(fetcher->m_nReceived, 3);
   BOOST_CHECK_EQUAL(fetcher->m_pendingSegments.size(), oldCwnd);
   BOOST_CHECK_EQUAL(face.sentInterests.size(), oldSentInterestsSize);
 
@@ -605,6 +783,44 @@ BOOST_AUTO_TEST_CASE(WindowSize)
   BOOST_CHECK_EQUAL(nCompletions, 0);
 }
 
+BOOST_AUTO_TEST_CASE(TimeoutEpisode)
+{
+  DummyValidator acceptValidator;
+  SegmentFetcher::Options options;
+  options.initCwnd = 4.0;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  connectSignals(fetcher);
+
+  advanceClocks(10_ms);
+  face.receive(*makeDataSegment("/hello/world/version0", 0, false));
+  advanceClocks(10_ms);
+  face.receive(*makeDataSegment("/hello/world/version0", 1, false));
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 6.0);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 6);
+  auto rto = fetcher->m_rttEstimator->getEstimatedRto();
+
+  // all Interests in flight time out together, which is a single loss episode
+  advanceClocks(10_ms, rto);
+  BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 6);
+  BOOST_CHECK_EQUAL(fetcher->m_rttEstimator->getEstimatedRto(), rto * 2);
+  BOOST_CHECK_EQUAL(fetcher->m_cc->getCwnd(), 3.0);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 3);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInRetxQueue, 3);
+
+  // the Data of an Interest that timed out, but has not been retransmitted yet, arrives late
+  uint64_t lastSegment = fetcher->m_pendingSegments.getEnd() - 1;
+  face.receive(*makeDataSegment("/hello/world/version0", lastSegment, false));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInRetxQueue, 2);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 3);
+
+  // retransmissions that time out again back off the RTO again
+  advanceClocks(10_ms, rto * 2);
+  BOOST_CHECK_EQUAL(fetcher->m_rttEstimator->getEstimatedRto(), rto * 4);
+  BOOST_CHECK_EQUAL(nErrors, 0);
+}
+
 BOOST_AUTO_TEST_CASE(MissingSegmentNum)
 {
   DummyValidator acceptValidator;
@@ -776,6 +992,208 @@ BOOST_AUTO_TEST_CASE(ValidationFailure)
   BOOST_CHECK_EQUAL(nErrors, 1);
 }
 
+BOOST_AUTO_TEST_CASE(Manifest)
+{
+  std::vector<uint8_t> content(5000);
+  for (size_t i = 0; i < content.size(); ++i) {
+    content[i] = static_cast<uint8_t>(i);
+  }
+  Segmenter segmenter(m_keyChain, signingByIdentity(m_keyChain.createIdentity("/producer")));
+  auto packets = segmenter.segmentWithManifest(content, "/hello/world/v=1", 100, 1_s);
+  BOOST_TEST_REQUIRE(packets.size() > 50);
+
+  std::map<Name, shared_ptr<Data>> published;
+  for (const auto& data : packets) {
+    published.emplace(data->getName(), data);
+  }
+  face.onSendInterest.connect([&] (const Interest& interest) {
+    auto it = published.find(interest.getName());
+    if (it == published.end() && interest.getCanBePrefix()) {
+      it = published.find(Name(interest.getName()).appendSegment(0));
+    }
+    if (it != published.end()) {
+      face.receive(*it->second);
+    }
+  });
+
+  size_t nValidations = 0;
+  DummyValidator validator;
+  validator.getPolicy().setResultCallback([&] (const Name&) {
+    ++nValidations;
+    return true;
+  });
+
+  SegmentFetcher::Options options;
+  options.useManifest = true;
+  options.probeLatestVersion = false;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world/v=1"), validator, options);
+  connectSignals(fetcher);
+  ConstBufferPtr result;
+  fetcher->onComplete.connect([&] (ConstBufferPtr buf) { result = buf; });
+
+  advanceClocks(10_ms, 100);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_REQUIRE(result != nullptr);
+  BOOST_TEST(*result == content, boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(nAfterSegmentValidated, 50);
+  // only the topmost manifest segment goes through the validator
+  BOOST_CHECK_EQUAL(nValidations, 1);
+
+  // a segment whose content does not match the manifest is rejected
+  auto forged = make_shared<Data>(*published.at("/hello/world/v=1/seg=7"));
+  forged->setContent("forged"sv);
+  m_keyChain.sign(*forged, signingWithSha256());
+  published[forged->getName()] = forged;
+
+  fetcher = SegmentFetcher::start(face, Interest("/hello/world/v=1"), validator, options);
+  connectSignals(fetcher);
+  advanceClocks(10_ms, 100);
+
+  BOOST_CHECK_EQUAL(nErrors, 1);
+  BOOST_CHECK_EQUAL(lastError, static_cast<uint32_t>(SegmentFetcher::SEGMENT_VALIDATION_FAIL));
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+}
+
+BOOST_AUTO_TEST_CASE(ManifestTooDeep)
+{
+  // every segment, including those of each manifest, is signed with DigestSha256 only
+  size_t nManifestInterests = 0;
+  face.onSendInterest.connect([&] (const Interest& interest) {
+    Name name = interest.getName();
+    if (!name[-1].isSegment()) {
+      name.appendSegment(0);
+    }
+    if (name[-2] == Segmenter::getManifestComponent()) {
+      ++nManifestInterests;
+    }
+    auto data = make_shared<Data>(name);
+    data->setContent("manifest"sv);
+    data->setFinalBlock(name[-1]);
+    m_keyChain.sign(*data, signingWithSha256());
+    face.receive(*data);
+  });
+
+  DummyValidator validator;
+  SegmentFetcher::Options options;
+  options.useManifest = true;
+  options.probeLatestVersion = false;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world/v=1"), validator, options);
+  connectSignals(fetcher);
+  advanceClocks(10_ms, 100);
+
+  BOOST_CHECK_EQUAL(nErrors, 1);
+  BOOST_CHECK_EQUAL(lastError, static_cast<uint32_t>(SegmentFetcher::SEGMENT_VALIDATION_FAIL));
+  BOOST_CHECK_EQUAL(nCompletions, 0);
+  BOOST_CHECK_EQUAL(nManifestInterests, SegmentFetcher::MAX_MANIFEST_DEPTH);
+}
+
+BOOST_AUTO_TEST_CASE(ValidationBacklog)
+{
+  security::Validator validator(make_unique<DeferredValidationPolicy>(),
+                                make_unique<security::CertificateFetcherOffline>());
+  auto& policy = static_cast<DeferredValidationPolicy&>(validator.getPolicy());
+
+  SegmentFetcher::Options options;
+  options.inOrder = true;
+  options.useConstantCwnd = true;
+  options.initCwnd = 4;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), validator, options);
+  connectSignals(fetcher);
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+
+  face.receive(*makeDataSegment("/hello/world/version0", 0, false));
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 0);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsValidating, 1);
+  // the segment awaiting validation occupies the window
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1);
+
+  advanceClocks(1_s);
+  policy.accept(0);
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsValidating, 0);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 4);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 5);
+  // the RTT is measured upon receipt and excludes the validation delay
+  BOOST_CHECK_LT(fetcher->m_rttEstimator->getSmoothedRtt(), 100_ms);
+
+  for (uint64_t seg = 1; seg <= 4; ++seg) {
+    face.receive(*makeDataSegment("/hello/world/version0", seg, seg == 4));
+  }
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsInFlight, 0);
+  BOOST_CHECK_EQUAL(fetcher->m_nSegmentsValidating, 4);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 5);
+  BOOST_CHECK_EQUAL(nAfterSegmentReceived, 5);
+  BOOST_CHECK_EQUAL(nOnInOrderData, 1);
+
+  // validation completes in reverse order, but content is still delivered in order
+  std::vector<uint8_t> delivered;
+  fetcher->onInOrderContent.connect([&] (span<const uint8_t> content) {
+    delivered.insert(delivered.end(), content.begin(), content.end());
+  });
+  for (size_t i = 4; i > 0; --i) {
+    policy.accept(i - 1);
+    advanceClocks(10_ms);
+  }
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_CHECK_EQUAL(nOnInOrderData, 5);
+  BOOST_CHECK_EQUAL(dataSize, 5 * 14);
+  BOOST_CHECK_EQUAL(delivered.size(), 4 * 14);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelValidation)
+{
+  std::vector<uint8_t> content(20000);
+  for (size_t i = 0; i < content.size(); ++i) {
+    content[i] = static_cast<uint8_t>(i);
+  }
+  auto identity = m_keyChain.createIdentity("/hello");
+  Segmenter segmenter(m_keyChain, signingByIdentity(identity));
+  auto packets = segmenter.segment(content, "/hello/world/v=1", 1000, 1_s);
+  BOOST_TEST_REQUIRE(packets.size() == 20);
+
+  face.onSendInterest.connect([&] (const Interest& interest) {
+    auto seg = interest.getName()[-1].isSegment() ? interest.getName()[-1].toSegment() : 0;
+    if (seg < packets.size()) {
+      face.receive(*packets[seg]);
+    }
+  });
+
+  security::Validator validator(make_unique<security::ValidationPolicySimpleHierarchy>(),
+                                make_unique<security::CertificateFetcherOffline>());
+  validator.loadAnchor("", security::Certificate(identity.getDefaultKey().getDefaultCertificate()));
+  validator.setVerificationThreads(m_io, 4);
+
+  SegmentFetcher::Options options;
+  options.inOrder = true;
+  options.probeLatestVersion = false;
+  options.initCwnd = 8;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world/v=1"), validator, options);
+  connectSignals(fetcher);
+  std::vector<uint8_t> delivered;
+  fetcher->onInOrderContent.connect([&] (span<const uint8_t> content) {
+    delivered.insert(delivered.end(), content.begin(), content.end());
+  });
+
+  // verifications complete on worker threads in real time
+  for (int i = 0; i < 5000 && nCompletions == 0 && nErrors == 0; ++i) {
+    advanceClocks(1_ms);
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_CHECK_EQUAL(nAfterSegmentValidated, 20);
+  BOOST_TEST(delivered == content, boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_CASE(Stop)
 {
   DummyValidator acceptValidator;
@@ -24,6 +24,9 @@
 #include "tests/boost-test.hpp"
 #include "tests/key-chain-fixture.hpp"
 
+#include <filesystem>
+#include <fstream>
+
 namespace ndn::tests {
 
 BOOST_AUTO_TEST_SUITE(Util)
@@ -137,6 +140,95 @@ BOOST_AUTO_TEST_CASE(MultipleSegments)
   check(segmenter.segment(ss, "/many", 42, 30_s));
 }
 
+BOOST_AUTO_TEST_CASE(File)
+{
+  namespace fs = std::filesystem;
+  const fs::path dir = fs::path(UNIT_TESTS_TMPDIR) / "TestSegmenter";
+  fs::create_directories(dir);
+  const auto filename = (dir / "blob").string();
+  const auto emptyFilename = (dir / "empty").string();
+  {
+    std::ofstream os(filename, std::ios::binary);
+    os.write(reinterpret_cast<const char*>(BLOB), sizeof(BLOB));
+    std::ofstream empty(emptyFilename);
+  }
+
+  Segmenter segmenter(m_keyChain, security::SigningInfo{});
+  auto expected = segmenter.segment(BLOB, "/many", 42, 30_s);
+  auto v = segmenter.segmentFile(filename, "/many", 42, 30_s);
+  BOOST_TEST_REQUIRE(v.size() == expected.size());
+  for (size_t i = 0; i < v.size(); ++i) {
+    BOOST_TEST(v[i]->getName() == expected[i]->getName());
+    BOOST_TEST(v[i]->getFinalBlock().value() == expected[i]->getFinalBlock().value());
+    BOOST_TEST(v[i]->getContent() == expected[i]->getContent(), boost::test_tools::per_element());
+  }
+
+  v = segmenter.segmentFile(emptyFilename, "/empty", 42, 30_s);
+  BOOST_TEST_REQUIRE(v.size() == 1);
+  BOOST_TEST(v[0]->getContent().value_size() == 0);
+
+  BOOST_CHECK_THROW(v = segmenter.segmentFile((dir / "missing").string(), "/foo", 42, 30_s),
+                    Segmenter::Error);
+  BOOST_CHECK_THROW(v = segmenter.segmentFile(dir.string(), "/foo", 42, 30_s), Segmenter::Error);
+
+  fs::remove_all(dir);
+}
+
+BOOST_AUTO_TEST_CASE(Manifest)
+{
+  Segmenter segmenter(m_keyChain, signingByIdentity(m_keyChain.createIdentity("/producer")));
+  std::vector<std::shared_ptr<Data>> v;
+  BOOST_CHECK_THROW(v = segmenter.segmentWithManifest(BLOB, "/many", 63, 30_s), std::invalid_argument);
+
+  // a single segment is signed directly
+  v = segmenter.segmentWithManifest(make_span(BLOB).first(64), "/one", 64, 30_s);
+  BOOST_TEST_REQUIRE(v.size() == 1);
+  BOOST_TEST(v[0]->getName() == "/one/seg=0");
+  BOOST_TEST(v[0]->getSignatureType() != tlv::DigestSha256);
+
+  v = segmenter.segmentWithManifest(BLOB, "/many", 64, 30_s);
+  const size_t nSegments = (sizeof(BLOB) + 63) / 64;
+  BOOST_TEST_REQUIRE(v.size() > nSegments);
+
+  // walk up the manifest levels: each one holds the digests of the level below
+  size_t levelBegin = 0;
+  size_t levelSize = nSegments;
+  Name levelName("/many");
+  while (true) {
+    for (size_t i = levelBegin; i < levelBegin + levelSize; ++i) {
+      BOOST_TEST(v[i]->getName() == Name(levelName).appendSegment(i - levelBegin));
+      BOOST_TEST(v[i]->getFinalBlock().value() == name::Component::fromSegment(levelSize - 1));
+      BOOST_TEST(v[i]->getSignatureType() == tlv::DigestSha256);
+    }
+
+    Buffer digests;
+    for (size_t i = levelBegin; i < levelBegin + levelSize; ++i) {
+      auto digest = v[i]->getFullName()[-1];
+      digests.insert(digests.end(), digest.value_begin(), digest.value_end());
+    }
+
+    levelBegin += levelSize;
+    levelSize = (digests.size() + 63) / 64;
+    levelName.append(Segmenter::getManifestComponent());
+    BOOST_TEST_REQUIRE(levelBegin + levelSize <= v.size());
+
+    Buffer manifest;
+    for (size_t i = levelBegin; i < levelBegin + levelSize; ++i) {
+      manifest.insert(manifest.end(), v[i]->getContent().value_begin(), v[i]->getContent().value_end());
+    }
+    BOOST_TEST(manifest == digests, boost::test_tools::per_element());
+
+    if (levelSize == 1) {
+      break;
+    }
+  }
+
+  // the topmost manifest is the only packet signed with a key
+  BOOST_TEST(levelBegin + 1 == v.size());
+  BOOST_TEST(v.back()->getName() == Name(levelName).appendSegment(0));
+  BOOST_TEST(v.back()->getSignatureType() != tlv::DigestSha256);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestSegmenter
 BOOST_AUTO_TEST_SUITE_END() // Util
 
@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/packet-tracer.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+constexpr std::string_view HELP_TEXT = R"STR(Usage: ndn-trace-dump [FILE]
+
+Decode a packet trace written by ndn::util::PacketTracer::dump() and print one line per event.
+If FILE is omitted or is '-', the trace is read from the standard input.
+
+Output columns:
+  TIME     microseconds since the first event
+  THREAD   index of the recording thread
+  EVENT    '<' outgoing / '>' incoming Interest (I), Data (D), Nack (N); 'tx'/'rx' at the
+           transport; 'satisfied', 'nacked', 'timeout' for Interests expressed by the app
+  NAME     hash of the packet name
+  SIZE     wire encoding size in octets
+  PIT      pending Interest ID
+)STR";
+
+static void
+printRecords(const std::vector<ndn::util::PacketTraceRecord>& records, std::ostream& os)
+{
+  if (records.empty()) {
+    return;
+  }
+
+  os << std::setw(14) << "TIME" << "  THREAD  " << std::left << std::setw(10) << "EVENT"
+     << std::setw(18) << "NAME" << std::right << std::setw(8) << "SIZE" << std::setw(10) << "PIT\n";
+
+  uint64_t start = records.front().timestamp;
+  for (const auto& r : records) {
+    std::ostringstream event;
+    event << r.event;
+    os << std::setw(14) << std::fixed << std::setprecision(3)
+       << static_cast<double>(r.timestamp - start) / 1000.0
+       << "  " << std::setw(6) << r.thread << "  "
+       << std::left << std::setw(10) << event.str();
+    if (r.nameHash != 0) {
+      os << std::hex << std::setfill('0') << std::setw(16) << r.nameHash
+         << std::dec << std::setfill(' ') << "  ";
+    }
+    else {
+      os << std::setw(18) << "-";
+    }
+    os << std::right << std::setw(8) << r.size << std::setw(10);
+    if (r.pitId != 0) {
+      os << r.pitId;
+    }
+    else {
+      os << "-";
+    }
+    os << '\n';
+  }
+}
+
+int
+main(int argc, char* argv[])
+{
+  if (argc > 2) {
+    std::cerr << HELP_TEXT;
+    return 2;
+  }
+
+  std::string filename = argc == 2 ? argv[1] : "-";
+  if (filename == "-h" || filename == "--help") {
+    std::cout << HELP_TEXT;
+    return 0;
+  }
+
+  try {
+    std::vector<ndn::util::PacketTraceRecord> records;
+    if (filename == "-") {
+      records = ndn::util::PacketTracer::load(std::cin);
+    }
+    else {
+      std::ifstream file(filename, std::ios::binary);
+      if (!file) {
+        std::cerr << "ERROR: cannot open '" << filename << "'" << std::endl;
+        return 1;
+      }
+      records = ndn::util::PacketTracer::load(file);
+    }
+    printRecords(records, std::cout);
+  }
+  catch (const std::exception& e) {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}